@@ -1,4 +1,15 @@
+#include "stream.h"
 
+/* Prints A0, A1 and A2 every 2 seconds. For noise measurements send
+ * "S<rate>" and a newline to stream them as binary frames at that rate,
+ * "X" and a newline goes back to printing. See stream.h and lightsensor.py. */
+
+const unsigned long BAUD_RATE = 921600; // Binary frames need the speed, USB ignores it
+const unsigned long PRINT_PERIOD_MS = 2 * 1000; // 2 sec
+
+char command[8];
+uint8_t commandLength = 0;
+unsigned long printTime = 0;
 
 void setup() {
   // put your setup code here, to run once:
@@ -6,8 +17,8 @@ void setup() {
   pinMode(A1, INPUT);
   pinMode(A2, INPUT);
 
-  // initialize serial communication at 9600 bits per second:
-  Serial.begin(9600);
+  // initialize serial communication:
+  Serial.begin(BAUD_RATE);
   delay(2*1000); // 2 sec
   while (!Serial); // Wait for Serial to initialize
   Serial.println("Setup done!");
@@ -15,6 +26,18 @@ void setup() {
 
 void loop() {
 
+  read_command();
+
+  if (stream_running()) {
+    stream_send(Serial);
+    return;
+  }
+
+  if (millis() - printTime < PRINT_PERIOD_MS) {
+    return;
+  }
+  printTime = millis();
+
   int value0 = analogRead(A0);
   int value1 = analogRead(A1);
   int value2 = analogRead(A2);
@@ -24,19 +47,23 @@ void loop() {
   Serial.println(value2);
   Serial.println();
   Serial.flush();
-
-  delay(2*1000); // 2 sec
-  //sleep(5);
 }
 
-void sleep(int minutes) {
-
-  for (int i = 0; i < 6; i++) 
-  {
-    for (int m = 0; m < minutes; m++) 
-    {
-      delay(10*1000); // 10 sec
+void read_command() {
+  while (Serial.available() > 0) {
+    char c = Serial.read();
+    if (c != '\n' && c != '\r') {
+      if (commandLength < sizeof(command) - 1) {
+        command[commandLength++] = c;
+      }
+      continue;
+    }
+    command[commandLength] = '\0';
+    if (command[0] == 'S') {
+      stream_start(atoi(&command[1]));
+    } else if (command[0] == 'X') {
+      stream_stop();
     }
+    commandLength = 0;
   }
-
 }
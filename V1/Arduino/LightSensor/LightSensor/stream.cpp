@@ -0,0 +1,176 @@
+#include "stream.h"
+
+#if !defined(ARDUINO_ARCH_SAMD)
+#error "The stream mode uses the SAMD21 TC3 timer and ADC"
+#endif
+
+// Private stuff -----------------------------------------------------------------------------
+
+const uint32_t TIMER_HZ = F_CPU / 64; // TC3 clock, GCLK0 with prescaler 64
+const uint8_t FRAME_SAMPLES = 64;     // Samples per frame, 256 bytes of payload
+const uint8_t PINS[] = {A0, A1, A2};
+
+// Written by the TC3 interrupt
+uint32_t buffers[2][FRAME_SAMPLES];
+uint16_t bufferSeq[2];            // Sequence number of each buffer
+volatile bool ready[2];           // Buffer is full and not sent yet
+volatile uint8_t fill;            // Buffer the interrupt writes to
+volatile uint8_t pos;             // Next sample in that buffer
+volatile uint16_t seq;
+volatile uint8_t dropped;
+
+uint16_t rate;
+bool running;
+uint16_t adcCtrlB;                // ADC setup of analogRead(), back at stream_stop()
+uint8_t adcSampCtrl;
+
+void adc_sync() {
+  while (ADC->STATUS.bit.SYNCBUSY);
+}
+
+void timer_sync() {
+  while (TC3->COUNT16.STATUS.bit.SYNCBUSY);
+}
+
+/* One conversion, without the extra one analogRead() does after a reference change */
+uint16_t adc_read(uint8_t pin) {
+  ADC->INPUTCTRL.bit.MUXPOS = g_APinDescription[pin].ulADCChannelNumber;
+  adc_sync();
+  ADC->SWTRIG.bit.START = 1;
+  while (ADC->INTFLAG.bit.RESRDY == 0);
+  return ADC->RESULT.reg; // Reading it clears RESRDY
+}
+
+/* Fletcher-16, cheap and it sees swapped bytes */
+void fletcher(uint8_t &sum1, uint8_t &sum2, const uint8_t *data, size_t length) {
+  for (size_t i = 0; i < length; i++) {
+    sum1 = (sum1 + data[i]) % 255;
+    sum2 = (sum2 + sum1) % 255;
+  }
+}
+
+// Public stuff -----------------------------------------------------------------------------
+
+void TC3_Handler() {
+  TC3->COUNT16.INTFLAG.reg = TC_INTFLAG_MC0;
+
+  uint32_t sample = adc_read(PINS[0]);
+  sample |= (uint32_t)adc_read(PINS[1]) << 10;
+  sample |= (uint32_t)adc_read(PINS[2]) << 20;
+  buffers[fill][pos++] = sample;
+
+  if (pos == FRAME_SAMPLES) {
+    pos = 0;
+    bufferSeq[fill] = seq++;
+    if (ready[fill ^ 1]) {
+      // The other one is still not sent, overwrite this one
+      if (dropped < 255) {
+        dropped++;
+      }
+    } else {
+      ready[fill] = true;
+      fill ^= 1;
+    }
+  }
+}
+
+void stream_start(uint16_t rateHz) {
+  stream_stop();
+  rate = constrain(rateHz, STREAM_MIN_RATE_HZ, STREAM_MAX_RATE_HZ);
+
+  // Let analogRead() set up the pins and the reference, then speed it up:
+  // 48MHz / 32 is within the 2.1MHz ADC maximum, a short sample time is fine
+  // for the sensor dividers
+  for (uint8_t pin : PINS) {
+    analogRead(pin);
+  }
+  adcCtrlB = ADC->CTRLB.reg;
+  adcSampCtrl = ADC->SAMPCTRL.reg;
+  ADC->CTRLB.bit.PRESCALER = ADC_CTRLB_PRESCALER_DIV32_Val;
+  adc_sync();
+  ADC->SAMPCTRL.reg = 8;
+  ADC->CTRLA.bit.ENABLE = 1;
+  adc_sync();
+
+  fill = 0;
+  pos = 0;
+  seq = 0;
+  dropped = 0;
+  ready[0] = ready[1] = false;
+
+  // TC3 in match frequency mode, an interrupt every 1/rate s
+  GCLK->CLKCTRL.reg = GCLK_CLKCTRL_CLKEN | GCLK_CLKCTRL_GEN_GCLK0 | GCLK_CLKCTRL_ID_TCC2_TC3;
+  while (GCLK->STATUS.bit.SYNCBUSY);
+  TC3->COUNT16.CTRLA.reg = TC_CTRLA_MODE_COUNT16 | TC_CTRLA_WAVEGEN_MFRQ | TC_CTRLA_PRESCALER_DIV64;
+  timer_sync();
+  TC3->COUNT16.CC[0].reg = TIMER_HZ / rate - 1;
+  timer_sync();
+  TC3->COUNT16.INTENSET.reg = TC_INTENSET_MC0;
+  NVIC_ClearPendingIRQ(TC3_IRQn);
+  NVIC_EnableIRQ(TC3_IRQn);
+  TC3->COUNT16.CTRLA.bit.ENABLE = 1;
+  timer_sync();
+
+  running = true;
+}
+
+void stream_stop() {
+  if (!running) {
+    return;
+  }
+  TC3->COUNT16.CTRLA.bit.ENABLE = 0;
+  timer_sync();
+  NVIC_DisableIRQ(TC3_IRQn);
+
+  ADC->CTRLA.bit.ENABLE = 0;
+  adc_sync();
+  ADC->CTRLB.reg = adcCtrlB;
+  adc_sync();
+  ADC->SAMPCTRL.reg = adcSampCtrl;
+
+  running = false;
+}
+
+bool stream_running() {
+  return running;
+}
+
+bool stream_send(Print &out) {
+  uint8_t b;
+
+  // At most one buffer is ready, see TC3_Handler()
+  if (ready[0]) {
+    b = 0;
+  } else if (ready[1]) {
+    b = 1;
+  } else {
+    return false;
+  }
+
+  uint8_t header[6];
+  header[0] = bufferSeq[b] & 0xFF;
+  header[1] = bufferSeq[b] >> 8;
+  header[2] = rate & 0xFF;
+  header[3] = rate >> 8;
+  header[4] = FRAME_SAMPLES;
+  noInterrupts();
+  header[5] = dropped;
+  dropped = 0;
+  interrupts();
+
+  // The SAMD21 is little endian, the samples go out as they are
+  const uint8_t *payload = (const uint8_t *)buffers[b];
+  uint8_t sum1 = 0, sum2 = 0;
+  fletcher(sum1, sum2, header, sizeof(header));
+  fletcher(sum1, sum2, payload, sizeof(buffers[b]));
+
+  out.write(0xA5);
+  out.write(0x5A);
+  out.write(header, sizeof(header));
+  out.write(payload, sizeof(buffers[b]));
+  out.write(sum1);
+  out.write(sum2);
+
+  ready[b] = false;
+  return true;
+}
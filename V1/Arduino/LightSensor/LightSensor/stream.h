@@ -0,0 +1,46 @@
+#ifndef _STREAM_H
+#define _STREAM_H
+
+#include <Arduino.h>
+
+/* This file contains the high rate sampler of the sensor inputs. A timer
+ * interrupt reads A0, A1 and A2 into a double buffer, full buffers go out as
+ * binary frames, all little endian:
+ *
+ *   0xA5 0x5A            sync
+ *   uint16 sequence      counts every buffer, sent or dropped
+ *   uint16 rate          samples per second
+ *   uint8  count         samples in the frame
+ *   uint8  dropped       buffers lost since the last frame, saturates at 255
+ *   uint32 x count       A0 | A1 << 10 | A2 << 20, 10 bits each
+ *   uint16 checksum      Fletcher-16 over sequence..samples
+ *
+ * lightsensor.py in V1 reads these frames. Only for the SAMD21, it uses the
+ * TC3 timer and the ADC registers directly. */
+
+const uint16_t STREAM_MIN_RATE_HZ = 12;   // TC3 is 16 bit at 750 kHz
+const uint16_t STREAM_MAX_RATE_HZ = 5000; // Three conversions take about 60us
+
+/**
+ * Start sampling at the given rate, clamped to the limits above
+ */
+void stream_start(uint16_t rateHz);
+
+/**
+ * Stop sampling, the ADC is back in its analogRead() setup
+ */
+void stream_stop();
+
+/**
+ * True while sampling
+ */
+bool stream_running();
+
+/**
+ * Write the full buffer as a frame, if there is one.
+ * Call it often: a buffer that is not sent before the next one is full is dropped.
+ * Returns true when a frame was written.
+ */
+bool stream_send(Print &out);
+
+#endif // _STREAM_H
@@ -29,20 +29,37 @@ const uint8_t   ERROR_MOTOR_RUN_TOO_LONG = 8;
 const uint16_t  THR_DAY = 200;    // Threshold used to switch from day->night (sensor is max 1023)
 const uint16_t  THR_NIGHT = 200;  // Threshold used to switch from night->day (sensor is max 1023)
 
-const uint32_t  FSM_PERIOD_MS = 100; // The period between FSM state checks
-const uint32_t  SLEEP_TIME_MS = (1 * SECONDS_IN_MINUTE * MILLIS_IN_SECOND) - FSM_PERIOD_MS;  // Low power sleep time in sleep state
-const uint32_t  PWM_DELAY_MS = 10; // Delays between PWM update values, PWM will go from 0 to 100, making the total ramp time PWM_DELAY_MS x 100
-const uint32_t  LOW_POWER_SLEEP_TIME_MS = 10000; // When not in LOW_POWER (see LowPower switch) we don't go to sleep, but use this delay to fake a sleep time
-
-/* Total time (consequent) day/night reading will need to trigger is SLEEP_TIME_MS x THR_SLEEP_COUNT x THR_DN_COUNT */
-/* ===> With these values this is 1min x 5 x 3 = 15 min */
-const uint8_t   THR_SLEEP_COUNT = 5; // The total sleep time will be SLEEP_TIME_MS times this value, to allow shorter wakeup intervals for sanity checking
-const uint8_t   THR_DN_COUNT = 3;    // Hysteresis counter, depending on time between sleeps this makes how long day/night should be read before changing
-
-/* Total time the motor should be running, this is counted every FSM_PERIOD_MS times.*/
-/* ===> With these values this is 100ms x 50 = 5s */
-const uint8_t   MAX_MOTOR_COUNT = 50;  // The maximum count the motor should be running.
-const uint8_t   MAX_MOTOR_SPEED = 50;  // PWM percentage
-                                          
+/* Timing inputs, everything below them is derived. Change these, not the derived values. */
+constexpr uint32_t FSM_PERIOD_MS = 100;        // The period between FSM state checks
+constexpr uint32_t WAKE_INTERVAL_MS = 1 * SECONDS_IN_MINUTE * MILLIS_IN_SECOND; // Sleep state wakes up this often, sanity check included
+constexpr uint32_t DAY_NIGHT_DELAY_MS = 15 * SECONDS_IN_MINUTE * MILLIS_IN_SECOND; // How long day/night should be read before the door moves
+constexpr uint32_t MOTOR_TIMEOUT_MS = 5 * MILLIS_IN_SECOND; // The motor running at full speed longer than this is an error
+constexpr uint32_t MOTOR_RAMP_MS = 500;        // Time to ramp from stop to full speed and back
+const uint8_t   MAX_MOTOR_SPEED = 50;          // PWM percentage
+const uint8_t   THR_SLEEP_COUNT = 5;           // Wake ups in the sleep state for every light sensor reading
+const uint32_t  LOW_POWER_SLEEP_TIME_MS = 10000; // When not in LOW_POWER (see LowPower switch) we don't go to deep sleep, but idle this long to fake a sleep time
+
+/* Derived timing */
+constexpr uint32_t SLEEP_TIME_MS = WAKE_INTERVAL_MS; // Low power sleep time in sleep state, that tick does not wait for FSM_PERIOD_MS after it
+constexpr uint32_t SENSOR_INTERVAL_MS = WAKE_INTERVAL_MS * THR_SLEEP_COUNT; // Time between light sensor readings
+constexpr uint8_t  THR_DN_COUNT = DAY_NIGHT_DELAY_MS / SENSOR_INTERVAL_MS - 1; // Hysteresis counter, day/night changes on reading THR_DN_COUNT + 1
+constexpr uint8_t  MAX_MOTOR_COUNT = MOTOR_TIMEOUT_MS / FSM_PERIOD_MS; // The maximum count the motor should be running, counted every FSM_PERIOD_MS
+constexpr uint32_t PWM_DELAY_MS = MOTOR_RAMP_MS / MAX_MOTOR_SPEED; // Delay between PWM steps, the ramp takes MAX_MOTOR_SPEED steps of 1%
+
+/* Bad tunings fail here, not in the coop */
+static_assert(WAKE_INTERVAL_MS > FSM_PERIOD_MS, "The wake up interval must be longer than an FSM tick");
+static_assert(SLEEP_TIME_MS % MILLIS_IN_SECOND == 0 && LOW_POWER_SLEEP_TIME_MS % MILLIS_IN_SECOND == 0,
+              "The RTC alarm of a sleep is in whole seconds");
+static_assert(FSM_PERIOD_MS < MILLIS_IN_SECOND, "The wait between ticks idles on the SysTick, it must stay under a second");
+static_assert(DAY_NIGHT_DELAY_MS % SENSOR_INTERVAL_MS == 0, "The day/night delay must be a whole number of sensor readings");
+static_assert(DAY_NIGHT_DELAY_MS / SENSOR_INTERVAL_MS >= 1, "The day/night delay must be at least one sensor reading, THR_DN_COUNT would be below 0");
+static_assert(DAY_NIGHT_DELAY_MS / SENSOR_INTERVAL_MS - 1 <= UINT8_MAX, "THR_DN_COUNT doesn't fit the uint8_t dayCount");
+static_assert(MOTOR_TIMEOUT_MS % FSM_PERIOD_MS == 0, "The motor timeout must be a whole number of FSM ticks");
+static_assert(MOTOR_TIMEOUT_MS / FSM_PERIOD_MS < UINT8_MAX, "MAX_MOTOR_COUNT doesn't fit a uint8_t");
+static_assert(MAX_MOTOR_SPEED > 0 && MAX_MOTOR_SPEED <= 100, "MAX_MOTOR_SPEED is a percentage");
+static_assert(MOTOR_RAMP_MS % MAX_MOTOR_SPEED == 0, "The ramp time must be a whole number of ms per PWM step");
+static_assert(PWM_DELAY_MS > 0 && PWM_DELAY_MS <= FSM_PERIOD_MS, "A PWM step must fit in an FSM tick");
+static_assert(MOTOR_RAMP_MS < MOTOR_TIMEOUT_MS, "The ramp takes longer than the motor may run");
+static_assert(THR_NIGHT <= THR_DAY && THR_DAY <= 1023, "The day/night thresholds are in the wrong order or out of range");
 
 #endif // _CONFIG_H
@@ -1,10 +1,10 @@
 #include "fsm.h"
+#include "json.h"
 #include "motor.h"
 #include "config.h"
+#include "src/core.h"
 
 #include <ArduinoLowPower.h>
-#include <ArduinoJson.h>
-#include <string>
 
 #define LOW_POWER (digitalRead(PIN_NOSLEEP) == LOW)
 
@@ -70,35 +70,153 @@ struct Fsm
     return bSensorClosed;
   }
 
+  /* The door is where it should be for day or night */
+  bool isDoorInPlace() 
+  {
+    return (isDay() && isDoorOpen()) || (isNight() && isDoorClosed());
+  }
+
 };
 
 void state_execute(Fsm &fsm);
 
 
 Fsm fsm;
+volatile bool doorSensorHit; // A door sensor stopped the motor, set by the interrupts
+volatile bool rtcAlarm;      // Set by the RTC alarm that ends a timed sleep
+
+uint32_t sleptMs; // Time slept that millis() did not count
+
+/* millis(), including the time slept */
+uint32_t now_ms()
+{
+  return millis() + sleptMs;
+}
+
+/* The RTC alarm of the last timed LowPower sleep went off */
+void alarm_isr()
+{
+  rtcAlarm = true;
+}
+
+/* One LowPower sleep, ms 0 sets no new RTC alarm */
+void low_power(uint32_t ms, bool idle, bool deep)
+{
+  if (ms == 0)
+  {
+    // Until the next interrupt
+    if (idle)
+    {
+      LowPower.idle();
+    }
+    else if (deep)
+    {
+      LowPower.deepSleep();
+    }
+    else
+    {
+      LowPower.sleep();
+    }
+  }
+  else if (idle)
+  {
+    LowPower.idle(ms);
+  }
+  else if (deep)
+  {
+    LowPower.deepSleep(ms);
+  }
+  else
+  {
+    LowPower.sleep(ms);
+  }
+}
+
+/**
+ * Sleep in the lowest power mode that is safe right now. Idle keeps the PWM
+ * and the USB serial port running, so it is used while the motor runs or
+ * when not in LOW_POWER. It sleeps until the RTC alarm, only a door sensor
+ * stopping the motor ends it early.
+ * ArduinoLowPower sets the alarm in whole seconds from the current one, so
+ * ms is a whole number of seconds and the sleep may be up to a second short.
+ * Use idle_ms() for less than a second.
+ */
+void sleep_ms(uint32_t ms, bool deep)
+{
+  uint32_t before = millis();
+  bool idle = !LOW_POWER || motor_running();
+  bool hit = doorSensorHit;
+
+  rtcAlarm = false;
+  low_power(ms, idle, deep);
+  while (!rtcAlarm && doorSensorHit == hit)
+  {
+    // Woken up by something else, the alarm is still set for the rest
+    low_power(0, idle, deep);
+  }
+
+  // The SysTick behind millis() stops in the sleep modes, add what it did not
+  // count. Only a door sensor wake-up is early, the RTC can't be read to the
+  // ms so that one counts as the whole time.
+  uint32_t counted = millis() - before;
+  if (counted < ms)
+  {
+    sleptMs += ms - counted;
+  }
+}
+
+/**
+ * Idle for less than a second, the 1 ms SysTick wakes it up and keeps
+ * millis() counting. Only a door sensor stopping the motor ends it early.
+ */
+void idle_ms(uint32_t ms)
+{
+  uint32_t before = millis();
+  bool hit = doorSensorHit;
+
+  while (millis() - before < ms && doorSensorHit == hit)
+  {
+    LowPower.idle();
+  }
+}
+
+/* Upper door sensor closed: cut the motor right away when opening the door */
+void uswitch_isr()
+{
+  if (motor_direction() == Direction::Up)
+  {
+    motor_halt();
+    doorSensorHit = true;
+  }
+}
+
+/* Bottom door sensor closed: cut the motor right away when closing the door */
+void bswitch_isr()
+{
+  if (motor_direction() == Direction::Down)
+  {
+    motor_halt();
+    doorSensorHit = true;
+  }
+}
 
-const char* print_state(enum State state)
+/* State names stay in flash */
+const __FlashStringHelper *print_state(enum State state)
 {
   switch (state)
   {
   case State::Sensor:
-    return ("Sensor");
-    break;
+    return F("Sensor");
   case State::Sleep:
-    return ("Sleep");
-    break;
+    return F("Sleep");
   case State::MotorRun:
-    return ("MotorRun");
-    break;
+    return F("MotorRun");
   case State::MotorCheck:
-    return ("MotorCheck");
-    break;
+    return F("MotorCheck");
   case State::MotorStop:
-    return ("MotorStop");
-    break;
+    return F("MotorStop");
   default:
-    return ("UNKNOWN STATE");
-    break;
+    return F("UNKNOWN STATE");
   }
 }
 
@@ -110,26 +228,22 @@ void debug(Fsm &fsm)
     digitalWrite(PIN_ERROR_STATE, fsm.error > 0 ? HIGH : LOW);
     digitalWrite(PIN_DAY_STATE, fsm.isDay() ? HIGH : LOW);
 
-    // Allocate the JSON document
-    JsonDocument doc;
-
-    // Add values in the document
-    doc["epoch"] = fsm.epoch;
-    doc["state"] = print_state(fsm.state);
-    doc["next"] = print_state(fsm.next);
-    doc["day"] = fsm.isDay();
-    doc["dayCount"] = fsm.dayCount;
-    doc["sleepCount"] = fsm.sleepCount;
-    doc["motorRunningCount"] = fsm.motorRunningCount;
-    doc["lSensorValue"] = fsm.lSensorValue;
-    doc["bSensorValue"] = fsm.bSensorValue;
-    doc["uSensorClosed"] = fsm.uSensorClosed;
-    doc["bSensorClosed"] = fsm.bSensorClosed;
-    doc["error"] = fsm.error;
-
+    // Streamed straight to the serial port, same JSON as serializeJson() gave
     // Note: Serial1 is on other connector. 
-    serializeJson(doc, Serial);
-    Serial.print("\n");
+    json_begin(Serial);
+    json_number(Serial, F("epoch"), fsm.epoch);
+    json_string(Serial, F("state"), print_state(fsm.state));
+    json_string(Serial, F("next"), print_state(fsm.next));
+    json_bool(Serial, F("day"), fsm.isDay());
+    json_number(Serial, F("dayCount"), fsm.dayCount);
+    json_number(Serial, F("sleepCount"), fsm.sleepCount);
+    json_number(Serial, F("motorRunningCount"), fsm.motorRunningCount);
+    json_number(Serial, F("lSensorValue"), fsm.lSensorValue);
+    json_number(Serial, F("bSensorValue"), fsm.bSensorValue);
+    json_bool(Serial, F("uSensorClosed"), fsm.uSensorClosed);
+    json_bool(Serial, F("bSensorClosed"), fsm.bSensorClosed);
+    json_number(Serial, F("error"), fsm.error);
+    json_end(Serial);
     
     // Read from serial here?
     if (Serial.available() > 0) 
@@ -142,15 +256,15 @@ void debug(Fsm &fsm)
           case 'U': 
             fsm.day = true;
             fsm.state = State::MotorRun;
-            Serial.println("Faking day");
+            Serial.println(F("Faking day"));
             break;
           case 'D': 
             fsm.day = false;
             fsm.state = State::MotorRun;
-            Serial.println("Faking night");
+            Serial.println(F("Faking night"));
             break;
           default:
-            Serial.print("Input unknown: ");
+            Serial.print(F("Input unknown: "));
             Serial.println(incomingByte);
             break;
         }
@@ -212,41 +326,10 @@ void read_input(Fsm &fsm)
 
 void state_Sensor(Fsm &fsm)
 {
-  bool changed = false;
-
   /* Handle state */
-  if (fsm.lSensorValue < THR_NIGHT)
-  {
-    // Reading a nighttime value
-    if (fsm.dayCount == 0)
-    {
-      // Counted enough nighttime values -> update
-      // Note: we get here all the time so only set changed flag when needed
-      changed = fsm.day; // When day was true this will set changed
-      fsm.day = false;
-    }
-    else
-    {
-      changed = false;
-      fsm.dayCount--;
-    }
-  }
-  else if (fsm.lSensorValue > THR_DAY)
-  {
-    // Reading a daytime values
-    if (fsm.dayCount >= THR_DN_COUNT)
-    {
-      // Counted enough daytime values -> update
-      // Note: we get here all the time so only set changed flag when needed
-      changed = !fsm.day;
-      fsm.day = true;
-    }
-    else
-    {
-      changed = false;
-      fsm.dayCount++;
-    }
-  }
+  bool day = core_day_night(fsm.day, &fsm.dayCount, fsm.lSensorValue, THR_NIGHT, THR_DAY, THR_DN_COUNT);
+  bool changed = day != fsm.day;
+  fsm.day = day;
 
   /* Decide on next state */
   if (changed)
@@ -264,11 +347,11 @@ void state_Sleep(Fsm &fsm)
   /* Handle state */
   if (LOW_POWER) 
   {
-    LowPower.deepSleep(SLEEP_TIME_MS);
+    sleep_ms(SLEEP_TIME_MS, true);
   }
   else 
   {
-    delay(LOW_POWER_SLEEP_TIME_MS);
+    sleep_ms(LOW_POWER_SLEEP_TIME_MS, false);
   }
   fsm.sleepCount++;
 
@@ -291,6 +374,7 @@ void state_MotorRun(Fsm &fsm)
   /* Handle state */
   
   fsm.motorRunningCount = 0;
+  doorSensorHit = false;
 
   if (fsm.isDay())
   {
@@ -314,11 +398,15 @@ void state_MotorRun(Fsm &fsm)
 void state_MotorCheck(Fsm &fsm)
 {
   /* Handle state */
-  fsm.motorRunningCount++;
+  if (!motor_ramping())
+  {
+    // Only full speed running counts, the ramp is not the door getting stuck
+    fsm.motorRunningCount++;
+  }
 
   /* Decide on next state */
-  if ((fsm.isDay() && fsm.isDoorOpen()) ||   // Opening door, upper sensor sees the door!
-      (fsm.isNight() && fsm.isDoorClosed()) ||   // Closing door, bottom sensor sees the door!
+  if (fsm.isDoorInPlace() ||   // Upper sensor sees the door opening, or the bottom one sees it closing!
+      doorSensorHit ||            // The interrupt saw it first and is already stopping
       (fsm.motorRunningCount > MAX_MOTOR_COUNT)) // This is taking too long
   {
     fsm.next = State::MotorStop;
@@ -332,16 +420,61 @@ void state_MotorCheck(Fsm &fsm)
 void state_MotorStop(Fsm &fsm)
 {
   /* Handle state */
-  motor_stop();
+  motor_stop(); // Only starts the ramp on the first tick, see motor.h
 
   /* Decide on next state */
-  fsm.next = State::Sensor;
+  if (motor_ramping())
+  {
+    // Don't go to sleep with the motor still running
+    fsm.next = State::MotorStop;
+  }
+  else
+  {
+    fsm.next = State::Sensor;
+  }
+}
+
+void wait_tick(Fsm &fsm, uint32_t start)
+{
+  // Ramp the motor until the next tick, the door sensors are checked on every step.
+  // Without a ramp there is nothing to do, so sleep the rest of the period.
+  while (now_ms() - start < FSM_PERIOD_MS)
+  {
+    if (doorSensorHit && fsm.next == State::MotorCheck)
+    {
+      // Already ramping down, don't wait for the next tick to see it
+      fsm.next = State::MotorStop;
+    }
+    if (motor_update() && fsm.next == State::MotorCheck)
+    {
+      fsm.uSensorClosed = digitalRead(PIN_USWITCH) == LOW;
+      fsm.bSensorClosed = digitalRead(PIN_BSWITCH) == LOW;
+      if (fsm.isDoorInPlace())
+      {
+        // Ramp down right away, not after the ramp up
+        motor_stop();
+        fsm.next = State::MotorStop;
+      }
+    }
+    if (!motor_ramping())
+    {
+      uint32_t elapsed = now_ms() - start;
+      if (elapsed < FSM_PERIOD_MS)
+      {
+        idle_ms(FSM_PERIOD_MS - elapsed);
+      }
+    }
+  }
 }
 
 void state_execute(Fsm &fsm)
 {
-  Serial.print("Will execute: ");
-  Serial.println(print_state(fsm.state));
+  if (!LOW_POWER)
+  {
+    // Serial is only started when not in low power
+    Serial.print(F("Will execute: "));
+    Serial.println(print_state(fsm.state));
+  }
   switch (fsm.state)
   {
   case State::Sensor:
@@ -382,6 +515,11 @@ void fsm_setup()
   pinMode(PIN_BSWITCH, INPUT);
   pinMode(PIN_NOSLEEP, INPUT);
 
+  // A door sensor closing stops the motor at once, also wakes up from deepSleep
+  LowPower.attachInterruptWakeup(PIN_USWITCH, uswitch_isr, FALLING);
+  LowPower.attachInterruptWakeup(PIN_BSWITCH, bswitch_isr, FALLING);
+  LowPower.attachInterruptWakeup(RTC_ALARM_WAKEUP, alarm_isr, CHANGE);
+
   // Setup the state
   fsm.state = State::Sensor;
   fsm.next = State::Sensor;
@@ -397,11 +535,13 @@ void fsm_setup()
 /* Run the FSM one time */
 void fsm_tick()
 {
+  uint32_t start = now_ms();
+
   fsm.epoch++;
   fsm.state = fsm.next;
 
   read_input(fsm);
   state_execute(fsm);
 
-  delay(FSM_PERIOD_MS);
+  wait_tick(fsm, start);
 }
\ No newline at end of file
@@ -0,0 +1,44 @@
+#include "json.h"
+
+// Private stuff -----------------------------------------------------------------------------
+
+static bool first; // No comma before the first key
+
+static void json_key(Print &out, const __FlashStringHelper *key) {
+  if (!first) {
+    out.print(',');
+  }
+  first = false;
+
+  out.print('"');
+  out.print(key);
+  out.print(F("\":"));
+}
+
+// Public stuff -----------------------------------------------------------------------------
+
+void json_begin(Print &out) {
+  first = true;
+  out.print('{');
+}
+
+void json_number(Print &out, const __FlashStringHelper *name, uint32_t value) {
+  json_key(out, name);
+  out.print(value);
+}
+
+void json_bool(Print &out, const __FlashStringHelper *name, bool value) {
+  json_key(out, name);
+  out.print(value ? F("true") : F("false"));
+}
+
+void json_string(Print &out, const __FlashStringHelper *name, const __FlashStringHelper *value) {
+  json_key(out, name);
+  out.print('"');
+  out.print(value);
+  out.print('"');
+}
+
+void json_end(Print &out) {
+  out.print(F("}\n"));
+}
@@ -0,0 +1,38 @@
+#ifndef _JSON_H
+#define _JSON_H
+
+#include <Arduino.h>
+
+/* This file contains a streaming JSON writer. Nothing is allocated: every
+ * value is printed as soon as it is given, keys and strings come from flash.
+ * The output is compact, like serializeJson() of ArduinoJson.
+ *
+ * Not reentrant: whether a comma is due is kept in one file static, so
+ * write one object at a time and never from an interrupt. */
+
+/**
+ * Start a JSON object
+ */
+void json_begin(Print &out);
+
+/**
+ * Add a number to the object
+ */
+void json_number(Print &out, const __FlashStringHelper *key, uint32_t value);
+
+/**
+ * Add true or false to the object
+ */
+void json_bool(Print &out, const __FlashStringHelper *key, bool value);
+
+/**
+ * Add a string to the object, it is not escaped
+ */
+void json_string(Print &out, const __FlashStringHelper *key, const __FlashStringHelper *value);
+
+/**
+ * End the object and the line
+ */
+void json_end(Print &out);
+
+#endif // _JSON_H
@@ -1,10 +1,14 @@
 #include "motor.h"
 #include "config.h"
+#include "src/core.h"
 
 // Private stuff -----------------------------------------------------------------------------
 
+// pwm and target are also set by motor_halt() from the door sensor interrupts
 Direction dir;
-uint8_t pwm; // Current pwm value, might be in ramp up/down
+volatile uint8_t pwm; // Current pwm value, might be in ramp up/down
+volatile uint8_t target; // Pwm value at the end of the ramp
+volatile uint32_t stepTime; // millis() of the last ramp step
 
 void setDutyPercent(uint8_t percent) {
 
@@ -13,6 +17,11 @@ void setDutyPercent(uint8_t percent) {
 
 }
 
+/* Motor output of core_ramp(), see src/core.h */
+struct DutyOutput {
+  static void run(uint8_t percent) { setDutyPercent(percent); }
+};
+
 // Public stuff -----------------------------------------------------------------------------
 
 void motor_setup() {
@@ -22,6 +31,7 @@ void motor_setup() {
 
   dir = Direction::Down;
   pwm = 0;
+  target = 0;
 }
 
 void motor_start(Direction d) {
@@ -34,21 +44,52 @@ void motor_start(Direction d) {
   {
     digitalWrite(PIN_MOTOR_DIR, 0);
   }
-  while (pwm < MAX_MOTOR_SPEED) {
-    pwm += 1;
-    setDutyPercent(pwm);
-    delay(PWM_DELAY_MS); // total ramp of 1s
-  }
+  target = MAX_MOTOR_SPEED;
+  stepTime = millis();
 }
 
 
 void motor_stop() {
 
-  while (pwm > 0) {
-    pwm -= 1;
-    setDutyPercent(pwm);
-    delay(PWM_DELAY_MS); // total ramp of 1s
+  if (target == 0) {
+    return; // Already stopping, a new stepTime would hold the ramp back
   }
+  target = 0;
+  stepTime = millis();
+}
+
+void motor_halt() {
+  setDutyPercent(0);
+  pwm = 0;
+  target = 0;
 }
 
+bool motor_update() {
+
+  if (pwm == target || millis() - stepTime < PWM_DELAY_MS) {
+    return false;
+  }
+
+  // One step at a time, a late call makes the ramp longer, not steeper
+  stepTime = millis();
 
+  // A motor_halt() in between would be undone by the step
+  noInterrupts();
+  uint8_t speed = pwm;
+  bool stepped = core_ramp<DutyOutput>(speed, target);
+  pwm = speed;
+  interrupts();
+  return stepped;
+}
+
+bool motor_ramping() {
+  return pwm != target;
+}
+
+bool motor_running() {
+  return pwm > 0;
+}
+
+Direction motor_direction() {
+  return dir;
+}
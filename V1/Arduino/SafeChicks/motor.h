@@ -14,13 +14,44 @@ enum Direction {
 void motor_setup();
 
 /**
- * Start the motor, which will ramp up to 100%
+ * Start the motor, which will ramp up to MAX_MOTOR_SPEED.
+ * Returns at once, motor_update() does the ramp.
  */
 void motor_start(Direction d);
 
 /**
- * Stop the motor, which will ramp down to 0%
+ * Stop the motor, which will ramp down to 0%.
+ * Returns at once, motor_update() does the ramp. Calling it again while
+ * stopping leaves the ramp as it is.
  */
 void motor_stop();
 
+/**
+ * Stop the motor at once, without a ramp, for a door sensor that closed.
+ * Safe to call from an interrupt.
+ */
+void motor_halt();
+
+/**
+ * Take the next ramp step when PWM_DELAY_MS has passed since the last one.
+ * Call it as often as possible.
+ * Returns true when a step was taken.
+ */
+bool motor_update();
+
+/**
+ * The motor is still ramping up or down
+ */
+bool motor_ramping();
+
+/**
+ * The motor PWM is on, ramping or at speed
+ */
+bool motor_running();
+
+/**
+ * Direction of the last motor_start()
+ */
+Direction motor_direction();
+
 #endif _MOTOR_H
\ No newline at end of file
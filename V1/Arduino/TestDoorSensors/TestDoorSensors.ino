@@ -1,6 +1,169 @@
 #include "config.h"
 
+/* Measurement bench for the door sensors. Every edge of PIN_USWITCH and
+ * PIN_BSWITCH is timestamped with micros() in an interrupt. Edges closer than
+ * SETTLE_US together are one actuation:
+ *   bounce   first to last edge of the actuation
+ *   latency  trigger edge to first edge, when PIN_TRIGGER is wired to a
+ *            reference: a push button pressed together with the magnet, or a
+ *            contact on the door rig
+ * Every actuation is printed, "r" prints the histograms and "c" clears them.
+ * The LEDs still mirror the sensors. The largest bounce is the shortest
+ * debounce window the FSM can use, FSM_PERIOD_MS should be well above it. */
 
+const uint8_t   PIN_TRIGGER = 9; // Reference input, pulled up, active low
+
+const uint32_t  SETTLE_US = 50000UL;     // No edge for this long ends an actuation
+const uint32_t  TRIGGER_WINDOW_US = 1000000UL; // A trigger older than this doesn't belong to the actuation
+const uint8_t   BUCKETS = 21;            // Bucket i counts values of 2^(i-1)..2^i - 1 us, the last one all above
+
+struct Edge {
+  uint32_t us;
+  uint8_t sensor;
+};
+
+struct Sensor {
+  const char *name;
+  uint8_t pin;
+  bool active; // Actuation in progress
+  uint32_t firstUs;
+  uint32_t lastUs;
+  uint16_t edges;
+  uint16_t bounce[BUCKETS];
+  uint16_t latency[BUCKETS];
+  uint32_t maxBounceUs;
+};
+
+Sensor sensors[] = {
+  {"upper", PIN_USWITCH},
+  {"bottom", PIN_BSWITCH},
+};
+
+// Written by the interrupts
+const uint8_t EDGE_COUNT = 64; // Power of 2
+volatile Edge edges[EDGE_COUNT];
+volatile uint8_t edgeHead = 0;
+volatile uint8_t edgeLost = 0;
+volatile uint32_t triggerUs = 0;
+volatile bool triggered = false;
+
+volatile uint8_t edgeTail = 0; // Written by loop(), read by the interrupts
+
+void push_edge(uint8_t sensor) {
+  uint32_t now = micros();
+  uint8_t next = (edgeHead + 1) & (EDGE_COUNT - 1);
+
+  if (next == edgeTail) {
+    if (edgeLost < 255) {
+      edgeLost++;
+    }
+    return;
+  }
+  edges[edgeHead].us = now;
+  edges[edgeHead].sensor = sensor;
+  edgeHead = next;
+}
+
+void uswitch_isr() {
+  push_edge(0);
+}
+
+void bswitch_isr() {
+  push_edge(1);
+}
+
+void trigger_isr() {
+  triggerUs = micros();
+  triggered = true;
+}
+
+uint8_t bucket(uint32_t us) {
+  uint8_t b = 0;
+  while (us > 0 && b < BUCKETS - 1) {
+    us >>= 1;
+    b++;
+  }
+  return b;
+}
+
+void print_histogram(const char *name, const char *what, const uint16_t *counts) {
+  Serial.print(name);
+  Serial.print(' ');
+  Serial.print(what);
+  Serial.println(" (us: count)");
+  for (uint8_t i = 0; i < BUCKETS; i++) {
+    if (counts[i] == 0) {
+      continue;
+    }
+    Serial.print("  ");
+    Serial.print(i == 0 ? 0 : 1UL << (i - 1));
+    if (i == BUCKETS - 1) {
+      Serial.print("+");
+    } else {
+      Serial.print("..");
+      Serial.print((1UL << i) - 1);
+    }
+    Serial.print(": ");
+    Serial.println(counts[i]);
+  }
+}
+
+void report() {
+  for (Sensor &s : sensors) {
+    print_histogram(s.name, "bounce", s.bounce);
+    print_histogram(s.name, "latency", s.latency);
+    Serial.print(s.name);
+    Serial.print(" max bounce ");
+    Serial.print(s.maxBounceUs);
+    Serial.println("us");
+  }
+}
+
+void clear() {
+  for (Sensor &s : sensors) {
+    memset(s.bounce, 0, sizeof(s.bounce));
+    memset(s.latency, 0, sizeof(s.latency));
+    s.maxBounceUs = 0;
+  }
+}
+
+/* The sensor was quiet for SETTLE_US, log the actuation */
+void finish(Sensor &s) {
+  uint32_t bounceUs = s.lastUs - s.firstUs;
+
+  s.active = false;
+  s.bounce[bucket(bounceUs)]++;
+  if (bounceUs > s.maxBounceUs) {
+    s.maxBounceUs = bounceUs;
+  }
+
+  Serial.print(s.name);
+  Serial.print(digitalRead(s.pin) == LOW ? " closed" : " opened");
+  Serial.print(", bounce ");
+  Serial.print(bounceUs);
+  Serial.print("us, ");
+  Serial.print(s.edges);
+  Serial.print(" edges");
+
+  noInterrupts();
+  uint32_t trigger = triggerUs;
+  bool hasTrigger = triggered;
+  triggered = false;
+  interrupts();
+  if (hasTrigger && s.firstUs - trigger < TRIGGER_WINDOW_US) {
+    uint32_t latencyUs = s.firstUs - trigger;
+    s.latency[bucket(latencyUs)]++;
+    Serial.print(", latency ");
+    Serial.print(latencyUs);
+    Serial.print("us");
+  }
+  Serial.println();
+}
+
+void mirror_leds() {
+  digitalWrite(PIN_DAY_STATE, digitalRead(PIN_USWITCH) == LOW ? HIGH : LOW);
+  digitalWrite(PIN_ERROR_STATE, digitalRead(PIN_BSWITCH) == LOW ? HIGH : LOW);
+}
 
 void setup() {
   // put your setup code here, to run once:
@@ -10,21 +173,63 @@ void setup() {
 
   pinMode(PIN_USWITCH, INPUT);
   pinMode(PIN_BSWITCH, INPUT);
+  pinMode(PIN_TRIGGER, INPUT_PULLUP);
+
+  Serial.begin(9600);
+  while (!Serial); // Wait for Serial to initialize
+
+  attachInterrupt(digitalPinToInterrupt(PIN_USWITCH), uswitch_isr, CHANGE);
+  attachInterrupt(digitalPinToInterrupt(PIN_BSWITCH), bswitch_isr, CHANGE);
+  attachInterrupt(digitalPinToInterrupt(PIN_TRIGGER), trigger_isr, FALLING);
+  Serial.println("Door sensor bench, r: report, c: clear");
 }
 
 void loop() {
   // put your main code here, to run repeatedly:
 
-  if (digitalRead(PIN_USWITCH) == LOW) {
-    digitalWrite(PIN_DAY_STATE, HIGH);
-  } else {
-    digitalWrite(PIN_DAY_STATE, LOW);
+  // Collect the edges
+  while (edgeTail != edgeHead) {
+    Edge e;
+    noInterrupts();
+    e.us = edges[edgeTail].us;
+    e.sensor = edges[edgeTail].sensor;
+    interrupts();
+    edgeTail = (edgeTail + 1) & (EDGE_COUNT - 1);
+
+    Sensor &s = sensors[e.sensor];
+    if (!s.active) {
+      s.active = true;
+      s.firstUs = e.us;
+      s.edges = 0;
+    }
+    s.lastUs = e.us;
+    s.edges++;
+  }
+  // Read and clear together, an edge lost in between would be cleared unseen
+  noInterrupts();
+  uint8_t lost = edgeLost;
+  edgeLost = 0;
+  interrupts();
+  if (lost > 0) {
+    Serial.print("Edges lost: ");
+    Serial.println(lost);
   }
 
+  // End the actuations that settled
+  for (Sensor &s : sensors) {
+    if (s.active && micros() - s.lastUs > SETTLE_US) {
+      finish(s);
+    }
+  }
 
-  if (digitalRead(PIN_BSWITCH) == LOW) {
-    digitalWrite(PIN_ERROR_STATE, HIGH);
-  } else {
-    digitalWrite(PIN_ERROR_STATE, LOW);
+  while (Serial.available() > 0) {
+    char c = Serial.read();
+    if (c == 'r') {
+      report();
+    } else if (c == 'c') {
+      clear();
+    }
   }
+
+  mirror_leds();
 }
@@ -1,6 +1,7 @@
 #include "fsm.h"
 #include "motor.h"
 #include "config.h"
+#include "src/core.h"
 
 #include <ArduinoLowPower.h>
 #include <ArduinoJson.h>
@@ -174,41 +175,10 @@ void read_input(Fsm &fsm)
 
 void state_Sensor(Fsm &fsm)
 {
-  bool changed = false;
-
   /* Handle state */
-  if (fsm.lSensorValue < THR_NIGHT)
-  {
-    // Reading a nighttime value
-    if (fsm.dayCount == 0)
-    {
-      // Counted enough nighttime values -> update
-      // Note: we get here all the time so only set changed flag when needed
-      changed = fsm.day; // When day was true this will set changed
-      fsm.day = false;
-    }
-    else
-    {
-      changed = false;
-      fsm.dayCount--;
-    }
-  }
-  else if (fsm.lSensorValue > THR_DAY)
-  {
-    // Reading a daytime values
-    if (fsm.dayCount >= THR_DN_COUNT)
-    {
-      // Counted enough daytime values -> update
-      // Note: we get here all the time so only set changed flag when needed
-      changed = !fsm.day;
-      fsm.day = true;
-    }
-    else
-    {
-      changed = false;
-      fsm.dayCount++;
-    }
-  }
+  bool day = core_day_night(fsm.day, &fsm.dayCount, fsm.lSensorValue, THR_NIGHT, THR_DAY, THR_DN_COUNT);
+  bool changed = day != fsm.day;
+  fsm.day = day;
 
   /* Decide on next state */
   if (changed)
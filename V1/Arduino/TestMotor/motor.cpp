@@ -1,5 +1,6 @@
 #include "motor.h"
 #include "config.h"
+#include "src/core.h"
 
 // Private stuff -----------------------------------------------------------------------------
 
@@ -13,6 +14,11 @@ void setDutyPercent(uint8_t percent) {
 
 }
 
+/* Motor output of core_ramp(), see src/core.h */
+struct DutyOutput {
+  static void run(uint8_t percent) { setDutyPercent(percent); }
+};
+
 // Public stuff -----------------------------------------------------------------------------
 
 void motor_setup() {
@@ -34,9 +40,7 @@ void motor_start(Direction d) {
   {
     digitalWrite(PIN_MOTOR_DIR, 0);
   }
-  while (pwm < 100) {
-    pwm += 1;
-    setDutyPercent(pwm);
+  while (core_ramp<DutyOutput>(pwm, 100)) {
     delay(10); // total ramp of 1s
   }
 }
@@ -44,9 +48,7 @@ void motor_start(Direction d) {
 
 void motor_stop() {
 
-  while (pwm > 0) {
-    pwm -= 1;
-    setDutyPercent(pwm);
+  while (core_ramp<DutyOutput>(pwm, 0)) {
     delay(10); // total ramp of 1s
   }
 }
@@ -0,0 +1,95 @@
+/* Generated from Core/core.h by 'make core' in V1/Arduino/host, edit that one */
+#ifndef _CORE_H
+#define _CORE_H
+
+/* This file contains the day/night hysteresis and the one-step motor ramp,
+ * the door logic that was the same on every board. It is plain C99 and C++,
+ * header only. Starting, timing and stopping the motor stay per board.
+ *
+ * Core/core.h is the one to edit. MPLAB X includes it from here, but the
+ * Arduino builder only sees the sketch folder, so each V1 sketch has a
+ * generated copy in its src/ folder. 'make core' in V1/Arduino/host writes
+ * the copies, 'make check-core' fails when one differs and every host build
+ * runs that check.
+ *
+ * Nothing in here touches hardware. The board binds its motor output at
+ * compile time: a policy class on Arduino (core_ramp<Output>), a macro or
+ * direct call next to core_ramp_step() on XC8. Everything is inlined, so
+ * there is no function pointer or virtual call. */
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+#define CORE_INLINE inline
+#else
+#define CORE_INLINE static inline
+#endif
+
+/**
+ * Day/night decision with hysteresis.
+ * A reading below the night threshold counts down, one above the day
+ * threshold counts up. Night is decided at a count of 0, day at dayCount.
+ * Readings between the thresholds change nothing.
+ * @param day: current decision, 1 when day
+ * @param count: hysteresis counter, updated
+ * @param light: light sensor reading
+ * @param nightThreshold: below this it is a night reading
+ * @param dayThreshold: above this it is a day reading
+ * @param dayCount: readings needed to change
+ * @return the new decision, 1 when day
+ */
+CORE_INLINE uint8_t core_day_night(uint8_t day, uint8_t *count, uint16_t light,
+                                   uint16_t nightThreshold, uint16_t dayThreshold,
+                                   uint8_t dayCount) {
+  if (light < nightThreshold) {
+    // Reading a nighttime value
+    if (*count == 0) {
+      return 0; // Counted enough nighttime values
+    }
+    (*count)--;
+  } else if (light > dayThreshold) {
+    // Reading a daytime value
+    if (*count >= dayCount) {
+      return 1; // Counted enough daytime values
+    }
+    (*count)++;
+  }
+  return day;
+}
+
+/**
+ * One step of a motor ramp, the speed moves one towards the target.
+ * @param speed: current speed, updated
+ * @param target: speed at the end of the ramp
+ * @return 1 when the speed changed and the motor output needs an update
+ */
+CORE_INLINE uint8_t core_ramp_step(uint8_t *speed, uint8_t target) {
+  if (*speed < target) {
+    (*speed)++;
+    return 1;
+  }
+  if (*speed > target) {
+    (*speed)--;
+    return 1;
+  }
+  return 0;
+}
+
+#ifdef __cplusplus
+/**
+ * Ramp step with the motor output bound at compile time.
+ * Output is a class with a static run(uint8_t speed), called when the speed
+ * changed. The call is resolved and inlined by the compiler.
+ * @return true when the speed changed
+ */
+template <class Output>
+inline bool core_ramp(uint8_t &speed, uint8_t target) {
+  if (core_ramp_step(&speed, target)) {
+    Output::run(speed);
+    return true;
+  }
+  return false;
+}
+#endif
+
+#endif // _CORE_H
@@ -0,0 +1,94 @@
+#ifndef _ARDUINO_H
+#define _ARDUINO_H
+
+/* This file contains a Linux shim of the Arduino API, enough to build the
+ * SafeChicks sketch on a PC. Time is virtual: delay() and the LowPower sleeps
+ * move it forward instead of waiting, see host.h for the simulation side. */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define HIGH 0x1
+#define LOW  0x0
+
+#define INPUT        0x0
+#define OUTPUT       0x1
+#define INPUT_PULLUP 0x2
+
+#define CHANGE  2
+#define FALLING 3
+#define RISING  4
+
+#define DEC 10
+#define HEX 16
+
+#define NUM_PINS    32
+#define LED_BUILTIN 13
+#define A0 14
+#define A1 15
+#define A2 16
+#define A3 17
+#define A4 18
+#define A5 19
+
+/* Strings are in RAM on a PC, F() only changes the type */
+class __FlashStringHelper;
+#define F(s) (reinterpret_cast<const __FlashStringHelper *>(s))
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+int analogRead(uint8_t pin);
+void analogWrite(uint8_t pin, int value);
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+/* Interrupts only run while time moves on, never in between these */
+inline void noInterrupts() {}
+inline void interrupts() {}
+
+#define digitalPinToInterrupt(p) (p)
+void attachInterrupt(uint8_t pin, void (*callback)(), int mode);
+void detachInterrupt(uint8_t pin);
+
+class Print
+{
+public:
+  virtual size_t write(uint8_t c) = 0;
+
+  size_t print(const char *s);
+  size_t print(const __FlashStringHelper *s);
+  size_t print(char c);
+  size_t print(unsigned char value, int base = DEC);
+  size_t print(int value, int base = DEC);
+  size_t print(unsigned int value, int base = DEC);
+  size_t print(long value, int base = DEC);
+  size_t print(unsigned long value, int base = DEC);
+
+  template <typename T>
+  size_t println(T value)
+  {
+    size_t n = print(value);
+    return n + print(F("\r\n"));
+  }
+  size_t println() { return print(F("\r\n")); }
+};
+
+/* The serial port, lines written go to the simulation */
+class HardwareSerial : public Print
+{
+public:
+  void begin(unsigned long baud);
+  int available();
+  int read();
+  void flush() {}
+  operator bool() { return true; }
+  size_t write(uint8_t c) override;
+};
+
+extern HardwareSerial Serial;
+
+#endif // _ARDUINO_H
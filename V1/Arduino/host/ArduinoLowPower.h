@@ -0,0 +1,28 @@
+#ifndef _ARDUINO_LOW_POWER_H
+#define _ARDUINO_LOW_POWER_H
+
+/* This file contains a Linux shim of the ArduinoLowPower library (SAMD).
+ * A sleep moves the virtual time forward, an interrupt ends it early. Like on
+ * the SAMD, millis() keeps counting in idle but not in sleep and deepSleep.
+ * A timed sleep sets the RTC alarm, a sleep without time waits for the next
+ * interrupt, that alarm included. */
+
+#include "Arduino.h"
+
+#define RTC_ALARM_WAKEUP 0xFF // Pin number of the RTC alarm, as in the library
+
+class ArduinoLowPowerClass
+{
+public:
+  void idle();
+  void idle(uint32_t ms);
+  void sleep();
+  void sleep(uint32_t ms);
+  void deepSleep();
+  void deepSleep(uint32_t ms);
+  void attachInterruptWakeup(uint32_t pin, void (*callback)(), uint32_t mode);
+};
+
+extern ArduinoLowPowerClass LowPower;
+
+#endif // _ARDUINO_LOW_POWER_H
@@ -0,0 +1,61 @@
+#ifndef _HOST_H
+#define _HOST_H
+
+/* This file contains the simulation side of the Arduino shim: the world model
+ * drives the input pins, virtual time and the serial port. */
+
+#include <stdint.h>
+
+/**
+ * World model, called every time before the virtual time moves on.
+ * Sets the inputs for the given time with host_set_digital/host_set_analog.
+ * Returns how many microseconds time may move on before it needs a new call.
+ */
+typedef uint32_t (*HostWorld)(uint64_t us);
+
+/**
+ * Get called for every line the sketch writes to Serial, without line end
+ */
+typedef void (*HostSerialLine)(const char *line);
+
+/**
+ * Start the simulation at time 0, before setup() of the sketch
+ */
+void host_begin(HostWorld world, HostSerialLine serial);
+
+/**
+ * Virtual time since host_begin(), sleeps included
+ */
+uint64_t host_micros();
+
+/**
+ * Move the virtual time on, the code of the sketch itself takes no time
+ */
+void host_advance(uint64_t us);
+
+/**
+ * Set an input pin, runs the attached interrupt on a matching edge
+ */
+void host_set_digital(uint8_t pin, uint8_t value);
+
+/**
+ * Set the value analogRead() returns for a pin
+ */
+void host_set_analog(uint8_t pin, uint16_t value);
+
+/**
+ * Value last written to an output pin with digitalWrite()
+ */
+uint8_t host_get_digital(uint8_t pin);
+
+/**
+ * Value last written to a pin with analogWrite(), 0..255
+ */
+uint8_t host_get_pwm(uint8_t pin);
+
+/**
+ * Queue bytes that Serial.read() will return
+ */
+void host_serial_input(const char *text);
+
+#endif // _HOST_H
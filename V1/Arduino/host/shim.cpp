@@ -0,0 +1,387 @@
+#include "Arduino.h"
+#include "ArduinoLowPower.h"
+#include "host.h"
+
+#include <deque>
+#include <string>
+
+// Private stuff -----------------------------------------------------------------------------
+
+/* A millis()/micros() call stands for one round of a busy-wait loop, so
+ * polling code still sees time pass */
+static const uint32_t BUSY_US = 10;
+
+struct Interrupt
+{
+  void (*callback)();
+  int mode;
+};
+
+static HostWorld world;
+static HostSerialLine serialLine;
+static bool inWorld; // The world and the interrupts it runs take no time
+
+static uint64_t nowUs;     // Virtual time
+static uint64_t sysTickUs; // What millis() counts, stops in sleep and deepSleep
+static bool interrupted;   // An interrupt ran since the last sleep started
+static uint64_t alarmUs;   // RTC alarm of the last timed sleep
+static bool alarmSet;
+static void (*alarmCallback)();
+
+static uint8_t pinModes[NUM_PINS];
+static uint8_t digitalValues[NUM_PINS];
+static uint16_t analogValues[NUM_PINS];
+static uint8_t pwmValues[NUM_PINS];
+static Interrupt handlers[NUM_PINS];
+
+static std::string serialOut;
+static std::deque<char> serialIn;
+
+/* Let the world set the inputs for now, returns the step it allows */
+static uint64_t call_world()
+{
+  inWorld = true;
+  uint64_t step = world ? world(nowUs) : 0;
+  inWorld = false;
+  return step;
+}
+
+/* Move time on, in the steps the world asks for. Stops early on an interrupt
+ * when wakeable. */
+static void advance(uint64_t us, bool counting, bool wakeable)
+{
+  uint64_t end = nowUs + us;
+
+  if (inWorld)
+  {
+    return;
+  }
+
+  interrupted = false;
+  while (nowUs < end && !(wakeable && interrupted))
+  {
+    uint64_t step = call_world();
+    if (step == 0 || step > end - nowUs)
+    {
+      step = end - nowUs;
+    }
+    nowUs += step;
+    if (counting)
+    {
+      sysTickUs += step;
+    }
+  }
+  call_world();
+}
+
+/* Sleep until an interrupt or the RTC alarm. In idle the SysTick keeps
+ * running and its 1 ms interrupt wakes it up too. Those wake-ups are left out
+ * while an alarm is set: the sketch only idles again on them (sleep_ms()), and
+ * a long idle stays fast to simulate. */
+static void low_power(bool counting)
+{
+  if (!alarmSet)
+  {
+    uint64_t us = counting ? 1000 - sysTickUs % 1000 : UINT64_MAX - nowUs;
+    advance(us, counting, true);
+    return;
+  }
+  advance(alarmUs > nowUs ? alarmUs - nowUs : 0, counting, true);
+  if (nowUs >= alarmUs)
+  {
+    alarmSet = false;
+    if (alarmCallback)
+    {
+      alarmCallback();
+    }
+  }
+}
+
+/* Like ArduinoLowPower on the SAMD RTC: the alarm is the current second plus
+ * the whole seconds in ms. Under a second it is the current second, which the
+ * RTC never matches again. */
+static void set_alarm(uint32_t ms)
+{
+  uint64_t second = nowUs / 1000000;
+
+  alarmUs = (second + ms / 1000) * 1000000;
+  alarmSet = ms >= 1000;
+}
+
+static size_t print_number(Print &out, unsigned long value, int base, bool negative)
+{
+  char buffer[24];
+  int i = sizeof(buffer);
+
+  buffer[--i] = '\0';
+  do
+  {
+    uint8_t digit = value % base;
+    buffer[--i] = digit < 10 ? '0' + digit : 'A' + digit - 10;
+    value /= base;
+  } while (value > 0);
+  if (negative)
+  {
+    buffer[--i] = '-';
+  }
+  return out.print(&buffer[i]);
+}
+
+// Arduino API -----------------------------------------------------------------------------
+
+void pinMode(uint8_t pin, uint8_t mode)
+{
+  pinModes[pin] = mode;
+  if (mode == INPUT_PULLUP)
+  {
+    digitalValues[pin] = HIGH;
+  }
+}
+
+void digitalWrite(uint8_t pin, uint8_t value)
+{
+  digitalValues[pin] = value ? HIGH : LOW;
+}
+
+int digitalRead(uint8_t pin)
+{
+  return digitalValues[pin];
+}
+
+int analogRead(uint8_t pin)
+{
+  return analogValues[pin];
+}
+
+void analogWrite(uint8_t pin, int value)
+{
+  pwmValues[pin] = value < 0 ? 0 : value > 255 ? 255 : value;
+}
+
+unsigned long millis()
+{
+  advance(BUSY_US, true, false);
+  return sysTickUs / 1000;
+}
+
+unsigned long micros()
+{
+  advance(BUSY_US, true, false);
+  return sysTickUs;
+}
+
+void delay(unsigned long ms)
+{
+  advance((uint64_t)ms * 1000, true, false);
+}
+
+void delayMicroseconds(unsigned int us)
+{
+  advance(us, true, false);
+}
+
+void attachInterrupt(uint8_t pin, void (*callback)(), int mode)
+{
+  handlers[pin].callback = callback;
+  handlers[pin].mode = mode;
+}
+
+void detachInterrupt(uint8_t pin)
+{
+  handlers[pin].callback = nullptr;
+}
+
+size_t Print::print(const char *s)
+{
+  size_t n = 0;
+  while (*s != '\0')
+  {
+    n += write(*s++);
+  }
+  return n;
+}
+
+size_t Print::print(const __FlashStringHelper *s)
+{
+  return print(reinterpret_cast<const char *>(s));
+}
+
+size_t Print::print(char c)
+{
+  return write(c);
+}
+
+size_t Print::print(unsigned char value, int base)
+{
+  return print_number(*this, value, base, false);
+}
+
+size_t Print::print(int value, int base)
+{
+  return print((long)value, base);
+}
+
+size_t Print::print(unsigned int value, int base)
+{
+  return print_number(*this, value, base, false);
+}
+
+size_t Print::print(long value, int base)
+{
+  if (value < 0 && base == DEC)
+  {
+    return print_number(*this, -(unsigned long)value, base, true);
+  }
+  return print_number(*this, (unsigned long)value, base, false);
+}
+
+size_t Print::print(unsigned long value, int base)
+{
+  return print_number(*this, value, base, false);
+}
+
+void HardwareSerial::begin(unsigned long baud)
+{
+  (void)baud;
+}
+
+int HardwareSerial::available()
+{
+  return serialIn.size();
+}
+
+int HardwareSerial::read()
+{
+  if (serialIn.empty())
+  {
+    return -1;
+  }
+  char c = serialIn.front();
+  serialIn.pop_front();
+  return c;
+}
+
+size_t HardwareSerial::write(uint8_t c)
+{
+  if (c == '\n')
+  {
+    if (serialLine)
+    {
+      serialLine(serialOut.c_str());
+    }
+    serialOut.clear();
+  }
+  else if (c != '\r')
+  {
+    serialOut += (char)c;
+  }
+  return 1;
+}
+
+HardwareSerial Serial;
+
+void ArduinoLowPowerClass::idle()
+{
+  low_power(true);
+}
+
+void ArduinoLowPowerClass::idle(uint32_t ms)
+{
+  set_alarm(ms);
+  idle();
+}
+
+void ArduinoLowPowerClass::sleep()
+{
+  low_power(false);
+}
+
+void ArduinoLowPowerClass::sleep(uint32_t ms)
+{
+  set_alarm(ms);
+  sleep();
+}
+
+void ArduinoLowPowerClass::deepSleep()
+{
+  low_power(false);
+}
+
+void ArduinoLowPowerClass::deepSleep(uint32_t ms)
+{
+  set_alarm(ms);
+  deepSleep();
+}
+
+void ArduinoLowPowerClass::attachInterruptWakeup(uint32_t pin, void (*callback)(), uint32_t mode)
+{
+  if (pin == RTC_ALARM_WAKEUP)
+  {
+    alarmCallback = callback;
+    return;
+  }
+  attachInterrupt(pin, callback, mode);
+}
+
+ArduinoLowPowerClass LowPower;
+
+// Simulation side -----------------------------------------------------------------------------
+
+void host_begin(HostWorld w, HostSerialLine serial)
+{
+  world = w;
+  serialLine = serial;
+  nowUs = 0;
+  sysTickUs = 0;
+  alarmSet = false;
+  call_world();
+}
+
+uint64_t host_micros()
+{
+  return nowUs;
+}
+
+void host_advance(uint64_t us)
+{
+  advance(us, true, false);
+}
+
+void host_set_digital(uint8_t pin, uint8_t value)
+{
+  uint8_t old = digitalValues[pin];
+
+  value = value ? HIGH : LOW;
+  digitalValues[pin] = value;
+
+  Interrupt &i = handlers[pin];
+  if (i.callback && old != value &&
+      (i.mode == CHANGE || (i.mode == FALLING && value == LOW) || (i.mode == RISING && value == HIGH)))
+  {
+    i.callback();
+    interrupted = true;
+  }
+}
+
+void host_set_analog(uint8_t pin, uint16_t value)
+{
+  analogValues[pin] = value;
+}
+
+uint8_t host_get_digital(uint8_t pin)
+{
+  return digitalValues[pin];
+}
+
+uint8_t host_get_pwm(uint8_t pin)
+{
+  return pwmValues[pin];
+}
+
+void host_serial_input(const char *text)
+{
+  while (*text != '\0')
+  {
+    serialIn.push_back(*text++);
+  }
+}
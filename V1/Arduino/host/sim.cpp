@@ -0,0 +1,330 @@
+#include "Arduino.h"
+#include "host.h"
+#include "config.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/* This file runs the SafeChicks sketch in a simulated coop: a day/night light
+ * curve, a door that moves with the motor and closes the door sensors at its
+ * ends, and optional scripted events. Virtual time, so a month takes seconds. */
+
+// The sketch
+void setup();
+void loop();
+
+// Private stuff -----------------------------------------------------------------------------
+
+namespace
+{
+
+const uint64_t US_IN_SECOND = 1000000;
+const uint64_t US_IN_DAY = 24 * 3600 * US_IN_SECOND;
+const uint32_t MOTOR_STEP_US = 1000;   // Door position update while the motor runs
+const uint32_t IDLE_STEP_US = 10000000; // Light update while nothing moves
+
+struct Options
+{
+  uint32_t days = 30;
+  double sunrise = 7.0;   // Hour of the day
+  double sunset = 19.0;
+  double twilight = 0.5;  // Hours from dark to full light
+  uint16_t dayLight = 800;
+  uint16_t nightLight = 20;
+  double travel = 2.5;    // Seconds to open or close the door at full PWM
+  bool nosleep = false;   // PIN_NOSLEEP high: serial on, no deep sleep
+  bool verbose = false;
+  std::string scenario;
+  std::string log;
+};
+
+/* Scripted input: "<day> <HH:MM[:SS]> <input> <value>" */
+struct Event
+{
+  uint64_t us;
+  std::string input; // light, battery, stuck, nosleep or serial
+  std::string value;
+};
+
+struct Stats
+{
+  uint64_t loops = 0;
+  double loopTotalUs = 0; // Host time spent in loop()
+  double loopMaxUs = 0;
+  uint32_t motorRuns = 0;
+  uint64_t motorLongestUs = 0;
+  uint64_t openAtNightUs = 0;   // Door not closed while dark
+  uint64_t closedAtDayUs = 0;   // Door not open while light
+  uint32_t jsonLines = 0;
+  uint32_t jsonErrors = 0;      // Lines with an error value
+};
+
+Options options;
+std::vector<Event> events;
+size_t nextEvent;
+Stats stats;
+std::ofstream logFile;
+
+// World state
+uint64_t lastUs;
+double door;          // 0 is closed, 1 is open
+bool stuck;           // The door doesn't move
+int lightOverride = -1;
+uint16_t battery = 800;
+bool motorOn;
+uint64_t motorStartUs;
+
+std::string clock_text(uint64_t us, bool withDay)
+{
+  uint64_t s = us / US_IN_SECOND;
+  char text[32];
+  if (withDay)
+  {
+    snprintf(text, sizeof(text), "%u+%02u:%02u:%02u", (unsigned)(s / 86400), (unsigned)(s / 3600 % 24),
+             (unsigned)(s / 60 % 60), (unsigned)(s % 60));
+  }
+  else
+  {
+    snprintf(text, sizeof(text), "%02u:%02u:%02u", (unsigned)(s / 3600 % 24), (unsigned)(s / 60 % 60),
+             (unsigned)(s % 60));
+  }
+  return text;
+}
+
+/* 0 at night, 1 during the day, linear through the twilight */
+double sun_light(uint64_t us)
+{
+  double hour = (double)(us % US_IN_DAY) / (3600 * US_IN_SECOND);
+  double morning = (hour - (options.sunrise - options.twilight / 2)) / options.twilight;
+  double evening = ((options.sunset + options.twilight / 2) - hour) / options.twilight;
+  return std::max(0.0, std::min(1.0, std::min(morning, evening)));
+}
+
+void apply(const Event &e)
+{
+  if (e.input == "light")
+  {
+    lightOverride = e.value == "auto" ? -1 : std::stoi(e.value);
+  }
+  else if (e.input == "battery")
+  {
+    battery = std::stoi(e.value);
+  }
+  else if (e.input == "stuck")
+  {
+    stuck = std::stoi(e.value) != 0;
+  }
+  else if (e.input == "nosleep")
+  {
+    options.nosleep = std::stoi(e.value) != 0;
+  }
+  else if (e.input == "serial")
+  {
+    host_serial_input(e.value.c_str());
+  }
+}
+
+uint32_t world(uint64_t us)
+{
+  uint64_t dt = us - lastUs;
+  lastUs = us;
+
+  // Door and motor
+  uint8_t pwm = host_get_pwm(PIN_MOTOR_PWM);
+  if (pwm > 0 && !stuck)
+  {
+    double move = (double)pwm / 255 * dt / (options.travel * US_IN_SECOND);
+    door += host_get_digital(PIN_MOTOR_DIR) ? move : -move;
+    door = std::max(0.0, std::min(1.0, door));
+  }
+  if (pwm > 0 && !motorOn)
+  {
+    stats.motorRuns++;
+    motorStartUs = us;
+  }
+  motorOn = pwm > 0;
+  if (motorOn)
+  {
+    stats.motorLongestUs = std::max(stats.motorLongestUs, us - motorStartUs);
+  }
+
+  // Safety of the flock
+  double light = sun_light(us);
+  if (light == 0 && door > 0)
+  {
+    stats.openAtNightUs += dt;
+  }
+  if (light == 1 && door < 1)
+  {
+    stats.closedAtDayUs += dt;
+  }
+
+  // Scripted events
+  while (nextEvent < events.size() && events[nextEvent].us <= us)
+  {
+    apply(events[nextEvent++]);
+  }
+
+  // Inputs, the door sensors pull low when closed
+  host_set_analog(PIN_LSENSOR, lightOverride >= 0 ? lightOverride
+                                                  : options.nightLight + light * (options.dayLight - options.nightLight));
+  host_set_analog(PIN_BSENSOR, battery);
+  host_set_digital(PIN_NOSLEEP, options.nosleep ? HIGH : LOW);
+  host_set_digital(PIN_USWITCH, door >= 1 ? LOW : HIGH);
+  host_set_digital(PIN_BSWITCH, door <= 0 ? LOW : HIGH);
+
+  uint64_t step = motorOn ? MOTOR_STEP_US : IDLE_STEP_US;
+  if (nextEvent < events.size())
+  {
+    step = std::min(step, events[nextEvent].us - us);
+  }
+  return step;
+}
+
+void serial_line(const char *line)
+{
+  bool json = line[0] == '{';
+
+  if (json)
+  {
+    stats.jsonLines++;
+    if (strstr(line, "\"error\":0}") == nullptr)
+    {
+      stats.jsonErrors++;
+    }
+    if (logFile.is_open())
+    {
+      // Same as the captured logs annelies.py reads
+      logFile << clock_text(host_micros(), false) << " " << line << "\n";
+    }
+  }
+  if (options.verbose)
+  {
+    std::cout << clock_text(host_micros(), true) << " " << line << "\n";
+  }
+}
+
+bool load_scenario(const std::string &path)
+{
+  std::ifstream file(path);
+  std::string line;
+
+  if (!file)
+  {
+    return false;
+  }
+  while (std::getline(file, line))
+  {
+    std::istringstream in(line);
+    unsigned day, h = 0, m = 0, s = 0;
+    std::string time;
+    Event e;
+
+    if (line.empty() || line[0] == '#' || !(in >> day >> time >> e.input))
+    {
+      continue;
+    }
+    std::getline(in >> std::ws, e.value);
+    sscanf(time.c_str(), "%u:%u:%u", &h, &m, &s);
+    e.us = day * US_IN_DAY + ((h * 60 + m) * 60 + s) * US_IN_SECOND;
+    events.push_back(e);
+  }
+  std::stable_sort(events.begin(), events.end(), [](const Event &a, const Event &b) { return a.us < b.us; });
+  return true;
+}
+
+void usage()
+{
+  std::cerr << "Usage: safechicks-sim [--days N] [--scenario FILE] [--log FILE] [--verbose] [--nosleep]\n"
+               "                      [--sunrise H] [--sunset H] [--travel S]\n";
+}
+
+} // namespace
+
+// Public stuff -----------------------------------------------------------------------------
+
+int main(int argc, char **argv)
+{
+  for (int i = 1; i < argc; i++)
+  {
+    std::string arg = argv[i];
+    bool more = i + 1 < argc;
+
+    if (arg == "--days" && more)
+      options.days = std::stoul(argv[++i]);
+    else if (arg == "--scenario" && more)
+      options.scenario = argv[++i];
+    else if (arg == "--log" && more)
+      options.log = argv[++i];
+    else if (arg == "--sunrise" && more)
+      options.sunrise = std::stod(argv[++i]);
+    else if (arg == "--sunset" && more)
+      options.sunset = std::stod(argv[++i]);
+    else if (arg == "--travel" && more)
+      options.travel = std::stod(argv[++i]);
+    else if (arg == "--verbose")
+      options.verbose = true;
+    else if (arg == "--nosleep")
+      options.nosleep = true;
+    else
+    {
+      usage();
+      return 2;
+    }
+  }
+  if (!options.scenario.empty() && !load_scenario(options.scenario))
+  {
+    std::cerr << "Can't read " << options.scenario << "\n";
+    return 2;
+  }
+  if (!options.log.empty())
+  {
+    logFile.open(options.log);
+  }
+
+  // Installed at noon with the door open
+  uint64_t startUs = 12 * 3600 * US_IN_SECOND;
+  door = 1;
+  for (Event &e : events)
+  {
+    e.us += startUs; // Scenario days count from midnight of the first day
+  }
+  host_begin(world, serial_line);
+  lastUs = 0;
+  host_advance(startUs);
+  stats = Stats(); // Only count from the install, the night before it had no door
+
+  auto wallStart = std::chrono::steady_clock::now();
+  uint64_t endUs = startUs + options.days * US_IN_DAY;
+  setup();
+  while (host_micros() < endUs)
+  {
+    auto t0 = std::chrono::steady_clock::now();
+    loop();
+    double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count();
+    stats.loops++;
+    stats.loopTotalUs += us;
+    stats.loopMaxUs = std::max(stats.loopMaxUs, us);
+  }
+  double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+
+  printf("Simulated          %u days in %.2f s\n", options.days, wall);
+  printf("FSM ticks          %llu\n", (unsigned long long)stats.loops);
+  printf("Tick cost (host)   %.2f us mean, %.2f us max\n", stats.loopTotalUs / std::max<uint64_t>(1, stats.loops),
+         stats.loopMaxUs);
+  printf("Motor runs         %u, longest %.2f s\n", stats.motorRuns, (double)stats.motorLongestUs / US_IN_SECOND);
+  printf("Open while dark    %.0f s\n", (double)stats.openAtNightUs / US_IN_SECOND);
+  printf("Closed while light %.0f s\n", (double)stats.closedAtDayUs / US_IN_SECOND);
+  if (stats.jsonLines > 0)
+  {
+    printf("Debug lines        %u, %u with an error\n", stats.jsonLines, stats.jsonErrors);
+  }
+  return 0;
+}
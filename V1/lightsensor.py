@@ -0,0 +1,184 @@
+import argparse
+import struct
+import time
+
+import numpy as np
+import matplotlib.pyplot as plt
+
+# Receiver of the binary frames of the LightSensor sketch in stream mode, see
+# Arduino/LightSensor/LightSensor/stream.h for the frame layout. Records A0..A2
+# and shows their noise: spectrum (Welch) and Allan deviation.
+
+SYNC = b'\xA5\x5A'
+HEADER = struct.Struct('<HHBB')  # sequence, rate, count, dropped
+CHANNELS = ['A0', 'A1', 'A2']
+THRESHOLD = 200  # THR_DAY / THR_NIGHT of the door controller
+
+
+def fletcher16(data):
+    sum1 = sum2 = 0
+    for b in data:
+        sum1 = (sum1 + b) % 255
+        sum2 = (sum2 + sum1) % 255
+    return sum1, sum2
+
+
+class FrameReader:
+    """Finds the frames in a byte stream, resyncs after garbage or a bad checksum"""
+
+    def __init__(self):
+        self.buffer = bytearray()
+        self.bad = 0
+
+    def feed(self, data):
+        self.buffer += data
+        frames = []
+        while True:
+            start = self.buffer.find(SYNC)
+            if start < 0:
+                del self.buffer[:-1]
+                return frames
+            del self.buffer[:start]
+            if len(self.buffer) < 2 + HEADER.size:
+                return frames
+            seq, rate, count, dropped = HEADER.unpack_from(self.buffer, 2)
+            length = 2 + HEADER.size + 4 * count + 2
+            if len(self.buffer) < length:
+                return frames
+            body = bytes(self.buffer[2:length - 2])
+            if fletcher16(body) != tuple(self.buffer[length - 2:length]):
+                # Not a frame after all, look for the next sync
+                self.bad += 1
+                del self.buffer[:1]
+                continue
+            packed = np.frombuffer(body, dtype='<u4', offset=HEADER.size)
+            samples = np.stack([(packed >> (10 * i)) & 0x3FF for i in range(3)], axis=1)
+            frames.append((seq, rate, dropped, samples))
+            del self.buffer[:length]
+
+
+def record(port, baudrate, rate, seconds):
+    import serial
+
+    reader = FrameReader()
+    frames = []
+    with serial.Serial(port, baudrate, timeout=0.1) as s:
+        s.write(f"S{rate}\n".encode('ascii'))
+        end = time.time() + seconds
+        while time.time() < end:
+            frames += reader.feed(s.read(4096))
+        s.write(b"X\n")
+    if reader.bad:
+        print(f"Frames with a bad checksum: {reader.bad}")
+    return frames
+
+
+def segments(frames):
+    """Join the frames into runs without gaps, a gap is a jump in the sequence number"""
+    runs = []
+    last = None
+    lost = 0
+    for seq, rate, dropped, samples in frames:
+        if last is None or seq != (last + 1) & 0xFFFF:
+            if last is not None:
+                lost += (seq - last - 1) & 0xFFFF
+            runs.append([])
+        runs[-1].append(samples)
+        last = seq
+    if lost:
+        print(f"Frames lost: {lost}, analysis is per run without gaps")
+    return [np.concatenate(run).astype(float) for run in runs]
+
+
+def welch(x, rate, nperseg=1024):
+    """Power spectral density in counts^2/Hz, Hann window, half overlap"""
+    nperseg = min(nperseg, len(x))
+    window = np.hanning(nperseg)
+    scale = rate * np.sum(window ** 2)
+    step = nperseg // 2
+    spectra = []
+    for start in range(0, len(x) - nperseg + 1, step):
+        part = x[start:start + nperseg]
+        spectrum = np.abs(np.fft.rfft((part - part.mean()) * window)) ** 2 / scale
+        spectrum[1:-1] *= 2  # One sided
+        spectra.append(spectrum)
+    return np.fft.rfftfreq(nperseg, 1 / rate), np.mean(spectra, axis=0)
+
+
+def allan(x, rate):
+    """Overlapping Allan deviation in counts, for tau in octaves"""
+    taus = []
+    devs = []
+    cumsum = np.concatenate(([0.0], np.cumsum(x)))
+    m = 1
+    while 2 * m < len(x):
+        means = (cumsum[m:] - cumsum[:-m]) / m  # Mean of every window of m samples
+        diff = means[m:] - means[:-m]
+        taus.append(m / rate)
+        devs.append(np.sqrt(0.5 * np.mean(diff ** 2)))
+        m *= 2
+    return np.array(taus), np.array(devs)
+
+
+def analyse(runs, rate):
+    longest = max(runs, key=len)
+    print(f"Samples: {sum(len(r) for r in runs)} at {rate} Hz, longest run {len(longest) / rate:.1f} s")
+
+    fig, (ax_psd, ax_adev) = plt.subplots(1, 2, figsize=(14, 6))
+    for i, name in enumerate(CHANNELS):
+        x = np.concatenate([r[:, i] for r in runs])
+        print(f"{name}: mean {x.mean():.2f} std {x.std():.2f} p2p {np.ptp(x):.0f} counts")
+
+        # Average the spectrum over all runs that are long enough
+        parts = [welch(r[:, i], rate) for r in runs if len(r) >= 1024] or [welch(longest[:, i], rate)]
+        freqs = parts[0][0]
+        psd = np.mean([p for f, p in parts if len(f) == len(freqs)], axis=0)
+        peaks = np.argsort(psd[1:])[-3:][::-1] + 1
+        print(f"    spectrum peaks at " + ", ".join(f"{freqs[p]:.1f} Hz" for p in peaks))
+        if abs(x.mean() - THRESHOLD) < 3 * x.std():
+            print(f"    within 3 sigma of the threshold {THRESHOLD}: noise alone can switch day/night")
+
+        taus, devs = allan(longest[:, i], rate)
+        ax_psd.loglog(freqs[1:], psd[1:], label=name)
+        ax_adev.loglog(taus, devs, marker='o', label=name)
+
+    ax_psd.set_xlabel('Frequency (Hz)')
+    ax_psd.set_ylabel('PSD (counts²/Hz)')
+    ax_psd.set_title('Noise spectrum')
+    ax_psd.grid(True, which='both', alpha=0.3)
+    ax_psd.legend()
+    ax_adev.set_xlabel('Tau (s)')
+    ax_adev.set_ylabel('Allan deviation (counts)')
+    ax_adev.set_title('Allan deviation')
+    ax_adev.grid(True, which='both', alpha=0.3)
+    ax_adev.legend()
+    plt.tight_layout()
+    plt.show()
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Record and analyse the light sensor noise of the LightSensor sketch.")
+    parser.add_argument("port", type=str, nargs='?', help="Serial port, e.g. COM4 or /dev/ttyACM0")
+    parser.add_argument("--baud", type=int, default=921600, help="Baud rate, ignored over USB")
+    parser.add_argument("--rate", type=int, default=2000, help="Samples per second, 12..5000")
+    parser.add_argument("--seconds", type=float, default=60, help="Recording time")
+    parser.add_argument("--save", type=str, help="Save the samples to this .npz file")
+    parser.add_argument("--load", type=str, help="Analyse a saved .npz file instead of recording")
+    args = parser.parse_args()
+
+    if args.load:
+        data = np.load(args.load)
+        rate = int(data['rate'])
+        runs = [data[k] for k in sorted(data.files) if k.startswith('run')]
+    elif args.port:
+        frames = record(args.port, args.baud, args.rate, args.seconds)
+        if not frames:
+            parser.error("No frames received")
+        rate = frames[0][1]
+        runs = segments(frames)
+        if args.save:
+            np.savez(args.save, rate=rate, **{f"run{i:04d}": r for i, r in enumerate(runs)})
+    else:
+        parser.error("Give a serial port or --load")
+
+    analyse(runs, rate)
@@ -0,0 +1,57 @@
+#include <stdbool.h>
+
+#include "CHECKPOINT_Controller.h"
+
+#include "../Drivers/EEPROM_Driver.h"
+#include "../config.h"
+
+/*******************************************************************************
+ *                      Function and type definitions
+ ******************************************************************************/
+
+/**
+ * EEPROM block: [CHECKPOINT_VERSION][Checkpoint][CRC-8 of the bytes before]
+ * Bump CHECKPOINT_VERSION when Checkpoint changes, old blocks are then ignored.
+ * A reset while saving breaks the CRC, the FSM then starts without one.
+ * Saving only queues the block, the CRC is calculated from RAM.
+ */
+#define CHECKPOINT_VERSION 1
+#define CHECKPOINT_BLOCK_SIZE (sizeof(Checkpoint) + 2)
+#define CHECKPOINT_CRC_ADDRESS                                                 \
+  (CHECKPOINT_EEPROM_START + CHECKPOINT_BLOCK_SIZE - 1)
+
+typedef char checkpoint_size_check
+    [CHECKPOINT_BLOCK_SIZE <= CHECKPOINT_EEPROM_SIZE ? 1 : -1];
+
+/*******************************************************************************
+ *                      Public function implementation
+ ******************************************************************************/
+
+bool C_CHECKPOINT_Load(Checkpoint *cp) {
+  uint8_t *bytes = (uint8_t *)cp;
+
+  if (D_EEPROM_Read(CHECKPOINT_EEPROM_START) != CHECKPOINT_VERSION) {
+    return false;
+  }
+  if (D_EEPROM_Crc8(CHECKPOINT_EEPROM_START, CHECKPOINT_BLOCK_SIZE - 1) !=
+      D_EEPROM_Read(CHECKPOINT_CRC_ADDRESS)) {
+    return false;
+  }
+
+  for (uint8_t i = 0; i < sizeof(Checkpoint); i++) {
+    bytes[i] = D_EEPROM_Read(CHECKPOINT_EEPROM_START + 1 + i);
+  }
+  return true;
+}
+
+void C_CHECKPOINT_Save(const Checkpoint *cp) {
+  const uint8_t *bytes = (const uint8_t *)cp;
+  uint8_t crc = D_EEPROM_Crc8Add(0x00, CHECKPOINT_VERSION);
+
+  D_EEPROM_Queue(CHECKPOINT_EEPROM_START, CHECKPOINT_VERSION);
+  for (uint8_t i = 0; i < sizeof(Checkpoint); i++) {
+    D_EEPROM_Queue(CHECKPOINT_EEPROM_START + 1 + i, bytes[i]);
+    crc = D_EEPROM_Crc8Add(crc, bytes[i]);
+  }
+  D_EEPROM_Queue(CHECKPOINT_CRC_ADDRESS, crc);
+}
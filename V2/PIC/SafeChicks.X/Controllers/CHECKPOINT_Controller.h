@@ -0,0 +1,44 @@
+#ifndef CHECKPOINT_CONTROLLER_H
+#define	CHECKPOINT_CONTROLLER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * This file contains the checkpoint of the FSM decisions in the data EEPROM.
+ * It is saved at state transitions and restored at start up, so after a reset
+ * the FSM continues with the day/night hysteresis and door position it had.
+ */
+
+/* Where the door is, as far as the FSM knows */
+typedef enum {
+  DOOR_UNKNOWN = 0, /* Never moved, moved by hand or the motor timed out   */
+  DOOR_UP,          /* Opened by the FSM                                   */
+  DOOR_DOWN,        /* Closed by the FSM                                   */
+  DOOR_MOVING,      /* The FSM was moving it, a reset stopped it halfway.
+                     * Only resumed when moving up, see C_FSM_Init()       */
+} Door;
+
+/* The saved part of the FSM */
+typedef struct {
+  uint8_t day;
+  uint8_t dayCount;
+  uint8_t door;
+  uint16_t error;  /* Only a record of the last error, it is not restored */
+} Checkpoint;
+
+/**
+ * Read the checkpoint from the EEPROM.
+ * @param cp: the checkpoint, only changed when a valid one was found
+ * @return true when a valid checkpoint was found
+ */
+bool C_CHECKPOINT_Load(Checkpoint *cp);
+
+/**
+ * Queue the checkpoint for the EEPROM, see D_EEPROM_Update(). Only changed
+ * bytes are written, so this wears nothing when nothing changed.
+ * @param cp: the checkpoint
+ */
+void C_CHECKPOINT_Save(const Checkpoint *cp);
+
+#endif	/* CHECKPOINT_CONTROLLER_H */
@@ -0,0 +1,106 @@
+#include <stdbool.h>
+#include <xc.h>
+
+#include "CLOCK_Controller.h"
+
+#include "../Drivers/TMR0_Driver.h"
+#include "../config.h"
+
+/*******************************************************************************
+ *                      Function and type definitions
+ ******************************************************************************/
+
+#define MICROS_IN_SECOND 1000000UL
+
+/* Timer0 count and period lengths, FOSC/4 = 250kHz = 4us */
+#define WORK_US_PER_COUNT   (4UL * TMR0_WORK_PRESCALE)
+#define SLEEP_US_PER_COUNT  (4UL * 256)     /* 1:256 pre-scale             */
+#define SLEEP_PERIOD_S      67UL            /* 65536 * 1024us = 67,108864s */
+#define SLEEP_PERIOD_US     108864UL
+
+/**
+ * Add microseconds to the clock.
+ * @param us: microseconds
+ */
+static void add_micros(uint32_t us);
+
+/*******************************************************************************
+ *                      Variables
+ ******************************************************************************/
+
+volatile uint32_t clockSeconds; // Whole seconds since start up
+volatile uint32_t clockMicros;  // Microseconds in the current second
+
+/*******************************************************************************
+ *                      Public function implementation
+ ******************************************************************************/
+
+void C_CLOCK_Init(void) {
+  clockSeconds = 0;
+  clockMicros = 0;
+}
+
+void C_CLOCK_Overflow(void) {
+  if (D_TMR0_Mode() == TIMER_MODE_WORK) {
+    add_micros(TMR0_WORK_PERIOD_US);
+  } else {
+    clockSeconds += SLEEP_PERIOD_S;
+    add_micros(SLEEP_PERIOD_US);
+  }
+}
+
+void C_CLOCK_Catchup(void) {
+  bool giel = INTCONbits.GIEL;
+  INTCONbits.GIEL = 0;
+
+  if (INTCONbits.TMR0IF == 1) {
+    // Period passed but not handled yet, the re-init would clear it
+    C_CLOCK_Overflow();
+    INTCONbits.TMR0IF = 0;
+  }
+
+  if (D_TMR0_Mode() == TIMER_MODE_WORK) {
+    add_micros((uint32_t)D_TMR0_Read() * WORK_US_PER_COUNT);
+  } else {
+    add_micros((uint32_t)D_TMR0_Read() * SLEEP_US_PER_COUNT);
+  }
+
+  INTCONbits.GIEL = giel;
+}
+
+uint32_t C_CLOCK_Seconds(void) {
+  uint32_t seconds;
+  bool giel = INTCONbits.GIEL;
+
+  INTCONbits.GIEL = 0;
+  seconds = clockSeconds;
+  INTCONbits.GIEL = giel;
+
+  return seconds;
+}
+
+uint32_t C_CLOCK_Millis(void) {
+  uint32_t seconds;
+  uint32_t micros;
+  bool giel = INTCONbits.GIEL;
+
+  INTCONbits.GIEL = 0;
+  seconds = clockSeconds;
+  micros = clockMicros;
+  INTCONbits.GIEL = giel;
+
+  return seconds * MILLIS_IN_SECOND + micros / 1000;
+}
+
+/*******************************************************************************
+ *                      Private function implementations
+ ******************************************************************************/
+
+void add_micros(uint32_t us) {
+  clockMicros += us;
+  // No division here, this also runs in the interrupt
+  while (clockMicros >= MICROS_IN_SECOND) {
+    clockMicros -= MICROS_IN_SECOND;
+    clockSeconds++;
+  }
+}
@@ -0,0 +1,43 @@
+#ifndef CLOCK_CONTROLLER_H
+#define	CLOCK_CONTROLLER_H
+
+#include <stdint.h>
+
+/**
+ * This file contains the monotonic uptime clock.
+ * Timer0 runs in work mode (8,192ms period) or sleep mode (67,1s period), the
+ * clock adds the real time of both, including a sleep that was cut short by
+ * a button.
+ */
+
+/**
+ * Initialise the clock at 0.
+ */
+void C_CLOCK_Init(void);
+
+/**
+ * Add one Timer0 period, in the mode Timer0 is running in.
+ * Call from the Timer0 interrupt.
+ */
+void C_CLOCK_Overflow(void);
+
+/**
+ * Add the time Timer0 counted since its last period. Call this right before
+ * Timer0 is initialised again, or that time is lost.
+ */
+void C_CLOCK_Catchup(void);
+
+/**
+ * Get the seconds since start up.
+ * @return seconds
+ */
+uint32_t C_CLOCK_Seconds(void);
+
+/**
+ * Get the milliseconds since start up. Wraps after 49 days, so only use it
+ * for differences.
+ * @return milliseconds
+ */
+uint32_t C_CLOCK_Millis(void);
+
+#endif	/* CLOCK_CONTROLLER_H */
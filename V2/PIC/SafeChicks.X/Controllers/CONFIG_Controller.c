@@ -0,0 +1,249 @@
+#include <stdbool.h>
+
+#include "CONFIG_Controller.h"
+#include "PRINT_Controller.h"
+
+#include "../Drivers/EEPROM_Driver.h"
+#include "../Drivers/UART_Driver.h"
+#include "../config.h"
+
+/*******************************************************************************
+ *                      Function and type definitions
+ ******************************************************************************/
+
+/**
+ * EEPROM block: [CONFIG_VERSION][Config][CRC-8 of the bytes before]
+ * Bump CONFIG_VERSION when Config changes, old blocks are then ignored.
+ */
+#define CONFIG_VERSION 1
+#define CONFIG_BLOCK_SIZE (sizeof(Config) + 2)
+#define CONFIG_CRC_ADDRESS (CONFIG_EEPROM_START + CONFIG_BLOCK_SIZE - 1)
+
+typedef char config_size_check[CONFIG_BLOCK_SIZE <= CONFIG_EEPROM_SIZE ? 1 : -1];
+
+#define CONFIG_VALUES 8     /* Values of a W: command                       */
+#define CONFIG_LINE_SIZE 56 /* "W:" and 8 values of 5 digits, with commas   */
+#define CONFIG_MAX_DOWN_MS 20000 /* So C_CONFIG_MaxMotorTime() fits 16 bits */
+
+/**
+ * Set the defaults of config.h.
+ * @param c: the settings
+ */
+static void set_defaults(Config *c);
+
+/**
+ * Check if settings can be used.
+ * @param c: the settings
+ * @return true when valid
+ */
+static bool is_valid(const Config *c);
+
+/**
+ * Write the settings in use to the EEPROM block.
+ */
+static void store(void);
+
+/**
+ * Parse comma separated decimal values.
+ * @param src: the text
+ * @param values: the parsed values
+ * @param count: the number of values that must be in the text
+ * @return true when exactly count valid values were found
+ */
+static bool parse_values(const char *src, uint16_t *values, uint8_t count);
+
+/*******************************************************************************
+ *                      Variables
+ ******************************************************************************/
+
+Config config;
+
+/* Command line, filled by the interrupt and emptied by main */
+char configLine[CONFIG_LINE_SIZE];
+volatile uint8_t configLineLength;
+volatile bool configLineReady;
+volatile bool configLineOverflow;
+
+/*******************************************************************************
+ *                      Public function implementation
+ ******************************************************************************/
+
+bool C_CONFIG_Init(void) {
+  Config stored;
+  uint8_t *bytes = (uint8_t *)&stored;
+
+  configLineLength = 0;
+  configLineReady = false;
+  configLineOverflow = false;
+  set_defaults(&config);
+
+  if (D_EEPROM_Read(CONFIG_EEPROM_START) != CONFIG_VERSION) {
+    return false; // Never written, erased or an older layout
+  }
+  if (D_EEPROM_Crc8(CONFIG_EEPROM_START, CONFIG_BLOCK_SIZE - 1) !=
+      D_EEPROM_Read(CONFIG_CRC_ADDRESS)) {
+    return false;
+  }
+
+  for (uint8_t i = 0; i < sizeof(Config); i++) {
+    bytes[i] = D_EEPROM_Read(CONFIG_EEPROM_START + 1 + i);
+  }
+  if (!is_valid(&stored)) {
+    return false;
+  }
+
+  config = stored;
+  return true;
+}
+
+bool C_CONFIG_Receive(uint8_t data) {
+  if (configLineReady) {
+    return false; // Previous command not handled yet, drop
+  }
+
+  if (data == '\n' || data == '\r') {
+    if (configLineOverflow || configLineLength == 0) {
+      // Too long or empty, start over
+      configLineOverflow = false;
+      configLineLength = 0;
+      return false;
+    }
+    configLine[configLineLength] = '\0';
+    configLineReady = true;
+    return true;
+  }
+
+  if (configLineLength < CONFIG_LINE_SIZE - 1) {
+    configLine[configLineLength++] = (char)data;
+  } else {
+    configLineOverflow = true;
+  }
+  return false;
+}
+
+void C_CONFIG_Command(void) {
+  uint16_t values[CONFIG_VALUES];
+  Config update;
+  bool ok = true;
+
+  if (!configLineReady) {
+    return;
+  }
+
+  if (configLine[0] == 'R' && configLine[1] == '\0') {
+    // Read, only reply
+  } else if (configLine[0] == 'D' && configLine[1] == '\0') {
+    D_EEPROM_Write(CONFIG_EEPROM_START, 0xFF);
+    set_defaults(&config);
+  } else if (configLine[0] == 'W' && configLine[1] == ':' &&
+             parse_values(&configLine[2], values, CONFIG_VALUES)) {
+    update.dayThreshold = values[0];
+    update.nightThreshold = values[1];
+    update.sleepTime = values[2];
+    update.dayCount = (uint8_t)values[3];
+    update.motorFullSpeed = (uint8_t)values[4];
+    update.motorHalfSpeed = (uint8_t)values[5];
+    update.motorDownFullMs = values[6];
+    update.motorDownSlowMs = values[7];
+    ok = values[3] <= 0xFF && values[4] <= 0xFF && values[5] <= 0xFF &&
+         is_valid(&update);
+    if (ok) {
+      config = update;
+      store();
+    }
+  } else {
+    ok = false;
+  }
+
+  // Free the line before the (slow) reply, the host waits for the reply
+  configLineLength = 0;
+  configLineReady = false;
+
+  if (ok) {
+    C_CONFIG_Print();
+  } else {
+    D_UART_Write("C:ERR\r\n");
+  }
+}
+
+void C_CONFIG_Print(void) {
+  C_PRINT_Str("C:");
+  C_PRINT_U16(config.dayThreshold);
+  C_PRINT_Field(config.nightThreshold);
+  C_PRINT_Field(config.sleepTime);
+  C_PRINT_Field(config.dayCount);
+  C_PRINT_Field(config.motorFullSpeed);
+  C_PRINT_Field(config.motorHalfSpeed);
+  C_PRINT_Field((uint16_t)C_CONFIG_MaxMotorTime());
+  C_PRINT_Field(config.motorDownFullMs);
+  C_PRINT_Field(config.motorDownSlowMs);
+  C_PRINT_End();
+}
+
+/*******************************************************************************
+ *                      Private function implementations
+ ******************************************************************************/
+
+void set_defaults(Config *c) {
+  c->dayThreshold = DAY_THRESHOLD;
+  c->nightThreshold = NIGHT_THRESHOLD;
+  c->sleepTime = SLEEP_TIME_S;
+  c->dayCount = DAY_COUNT;
+  c->motorFullSpeed = MOTOR_FULL_SPEED;
+  c->motorHalfSpeed = MOTOR_HALF_SPEED;
+  c->motorDownFullMs = MOTOR_DOWN_FULL_MS;
+  c->motorDownSlowMs = MOTOR_DOWN_SLOW_MS;
+}
+
+bool is_valid(const Config *c) {
+  return c->dayThreshold <= 1023 &&              // 10-bit ADC
+         c->nightThreshold <= c->dayThreshold && // Else day and night overlap
+         c->sleepTime > 0 &&
+         c->sleepTime <= MAX_SLEEP_TIME_S &&
+         c->motorFullSpeed <= 100 &&             // PWM percentage
+         c->motorHalfSpeed > 0 &&
+         c->motorHalfSpeed <= c->motorFullSpeed &&
+         ((uint32_t)c->motorDownFullMs + c->motorDownSlowMs) <=
+             CONFIG_MAX_DOWN_MS;
+}
+
+void store(void) {
+  const uint8_t *bytes = (const uint8_t *)&config;
+
+  // Invalidate first, so a reset halfway leaves no half written block
+  D_EEPROM_Write(CONFIG_EEPROM_START, 0xFF);
+  for (uint8_t i = 0; i < sizeof(Config); i++) {
+    D_EEPROM_Write(CONFIG_EEPROM_START + 1 + i, bytes[i]);
+  }
+  D_EEPROM_Write(CONFIG_EEPROM_START, CONFIG_VERSION);
+  D_EEPROM_Write(CONFIG_CRC_ADDRESS,
+                 D_EEPROM_Crc8(CONFIG_EEPROM_START, CONFIG_BLOCK_SIZE - 1));
+}
+
+bool parse_values(const char *src, uint16_t *values, uint8_t count) {
+  uint8_t found = 0;
+  uint32_t value = 0;
+  bool digits = false;
+
+  for (;; src++) {
+    if (*src >= '0' && *src <= '9') {
+      value = value * 10 + (uint8_t)(*src - '0');
+      if (value > 0xFFFF) {
+        return false;
+      }
+      digits = true;
+    } else if (*src == ',' || *src == '\0') {
+      if (!digits || found == count) {
+        return false;
+      }
+      values[found++] = (uint16_t)value;
+      value = 0;
+      digits = false;
+      if (*src == '\0') {
+        return found == count;
+      }
+    } else {
+      return false;
+    }
+  }
+}
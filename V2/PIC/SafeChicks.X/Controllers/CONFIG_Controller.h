@@ -0,0 +1,65 @@
+#ifndef CONFIG_CONTROLLER_H
+#define	CONFIG_CONTROLLER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * This file contains the runtime configuration.
+ * The settings are stored in a versioned block with a CRC in the data EEPROM
+ * and loaded once at start up. When the block is missing or broken the
+ * defaults of config.h are used.
+ *
+ * The host tool (V2/config_tool.py) changes them over the UART with one line
+ * commands:
+ *  R                 Reply the current settings as a C: line
+ *  W:<8 values>      Check, store and use new settings, reply the C: line
+ *  D                 Erase the stored settings and use the defaults again
+ * A command that can not be used is answered with "C:ERR".
+ */
+
+/* Runtime settings, see config.h for the meaning and the defaults */
+typedef struct {
+  uint16_t dayThreshold;
+  uint16_t nightThreshold;
+  uint16_t sleepTime;       // s
+  uint8_t dayCount;
+  uint8_t motorFullSpeed;
+  uint8_t motorHalfSpeed;
+  uint16_t motorDownFullMs;
+  uint16_t motorDownSlowMs;
+} Config;
+
+/* The settings in use, only changed by the functions below */
+extern Config config;
+
+/* Max time the motor may run, derived from the down times */
+#define C_CONFIG_MaxMotorTime()                                                \
+  (3U * (config.motorDownFullMs + config.motorDownSlowMs))
+
+/**
+ * Load the settings from the EEPROM, or the defaults.
+ * @return true when the stored settings are used
+ */
+bool C_CONFIG_Init(void);
+
+/**
+ * Add a received byte to the command line.
+ * Call from the UART receive interrupt.
+ * @param data: the received byte
+ * @return true when a full command line is waiting for C_CONFIG_Command()
+ */
+bool C_CONFIG_Receive(uint8_t data);
+
+/**
+ * Handle the waiting command line, and reply on the UART.
+ * Writes the EEPROM, so only call from main.
+ */
+void C_CONFIG_Command(void);
+
+/**
+ * Write the settings in use as a C: line to the UART.
+ */
+void C_CONFIG_Print(void);
+
+#endif	/* CONFIG_CONTROLLER_H */
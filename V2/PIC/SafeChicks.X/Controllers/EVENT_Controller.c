@@ -0,0 +1,59 @@
+#include "EVENT_Controller.h"
+
+/*******************************************************************************
+ *                      Function and type definitions
+ ******************************************************************************/
+
+/* The indexes wrap with a mask, so the size must be a power of two */
+typedef char event_size_check[(EVENT_QUEUE_SIZE & (EVENT_QUEUE_SIZE - 1)) == 0 ? 1 : -1];
+
+#define nextIndex(i) (((i) + 1) & (EVENT_QUEUE_SIZE - 1))
+
+/*******************************************************************************
+ *                      Public function implementation
+ ******************************************************************************/
+
+void C_EVENT_Init(EventQueue *q) {
+  q->head = 0;
+  q->tail = 0;
+  q->dropped = 0;
+}
+
+bool C_EVENT_Push(EventQueue *q, Event e) {
+  uint8_t head = q->head;
+  uint8_t next = nextIndex(head);
+
+  if (next == q->tail) {
+    // Full
+    if (q->dropped < 0xFF) {
+      q->dropped++;
+    }
+    return false;
+  }
+
+  q->data[head] = (uint8_t)e;
+  q->head = next; // Publish after the data is written
+  return true;
+}
+
+Event C_EVENT_Pop(EventQueue *q) {
+  uint8_t tail = q->tail;
+  Event e;
+
+  if (tail == q->head) {
+    return EVENT_NONE;
+  }
+
+  e = (Event)q->data[tail];
+  q->tail = nextIndex(tail); // Release after the data is read
+  return e;
+}
+
+Event C_EVENT_Peek(EventQueue *q) {
+  uint8_t tail = q->tail;
+
+  if (tail == q->head) {
+    return EVENT_NONE;
+  }
+  return (Event)q->data[tail];
+}
@@ -0,0 +1,61 @@
+#ifndef EVENT_CONTROLLER_H
+#define	EVENT_CONTROLLER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * This file contains the event queue between the interrupts and main().
+ * It is a single producer (one interrupt) single consumer (main) ring, so it
+ * needs no locking: the producer only writes head, the consumer only writes
+ * tail, and both are single bytes.
+ * No xc.h in here, so it also builds for the host simulator (V2/sim).
+ */
+
+#define EVENT_QUEUE_SIZE 8 /* Power of two, holds EVENT_QUEUE_SIZE - 1 events */
+
+typedef enum {
+  EVENT_NONE = 0,    /* Queue is empty                                       */
+  EVENT_TICK,        /* TMR0 period passed                                   */
+  EVENT_BUTTON_UP,   /* INT0, up button pushed                               */
+  EVENT_BUTTON_DOWN, /* INT1, down button pushed                             */
+  EVENT_COMMAND,     /* UART, a config command line came in                  */
+} Event;
+
+typedef struct {
+  volatile uint8_t head;    // Written by the producer only
+  volatile uint8_t tail;    // Written by the consumer only
+  volatile uint8_t dropped; // Events lost because the queue was full
+  volatile uint8_t data[EVENT_QUEUE_SIZE];
+} EventQueue;
+
+/**
+ * Initialise (empty) a queue. Call before the interrupts are enabled.
+ * @param q: the queue
+ */
+void C_EVENT_Init(EventQueue *q);
+
+/**
+ * Add an event, only to be called by the producer (interrupt).
+ * @param q: the queue
+ * @param e: the event
+ * @return false when the queue was full and the event is dropped
+ */
+bool C_EVENT_Push(EventQueue *q, Event e);
+
+/**
+ * Take the oldest event, only to be called by the consumer (main).
+ * @param q: the queue
+ * @return the event, EVENT_NONE when the queue is empty
+ */
+Event C_EVENT_Pop(EventQueue *q);
+
+/**
+ * Look at the oldest event without taking it, only to be called by the
+ * consumer (main).
+ * @param q: the queue
+ * @return the event, EVENT_NONE when the queue is empty
+ */
+Event C_EVENT_Peek(EventQueue *q);
+
+#endif	/* EVENT_CONTROLLER_H */
@@ -1,84 +1,141 @@
 #include <builtins.h>
 #include <stdbool.h>
 
+#include "CHECKPOINT_Controller.h"
+#include "CLOCK_Controller.h"
+#include "CONFIG_Controller.h"
 #include "FSM_Controller.h"
+#include "FSM_Table.h"
+#include "LOG_Controller.h"
+#include "PRINT_Controller.h"
+#include "SERIES_Controller.h"
+#include "TIMING_Controller.h"
+#include "TRACE_Controller.h"
 
 #include "../Drivers/ADC_Driver.h"
+#include "../Drivers/EEPROM_Driver.h"
 #include "../Drivers/MOTOR_Driver.h"
+#include "../Drivers/UART_Driver.h"
 #include "../config.h"
-
-#include <stdio.h>
+#include "../../../../Core/core.h"
 
 /*******************************************************************************
  *                      Function and type definitions
  ******************************************************************************/
 
-/* Enumeration to keep the FSM state */
-typedef enum {
-  Calculate, /* Calculate depending on input                             */
-  Sleep,     /* Sleep for certain time before starting again             */
-
-  MotorStart,   /* Start running the motor up or down                       */
-  MotorRunning, /* Run the motor, read sensors to see if motor should stop  */
-  MotorSlow,    /* Run the motor, slow, until sensor is out again           */
-  MotorStop,    /* Stop running the motor                                   */
-
-  ForceUp,   /* Force the motor to run in Up direction. No checks!       */
-  ForceDown, /* Force the motor to run in Down direction. No checks!     */
-} State;
-
-/* All FSM variables and data  */
+/* All FSM variables and data, sized for an 8-bit core: counters as small as
+ * their range allows, flags and small codes packed in one byte */
 typedef struct {
-  uint32_t epoch; // Clock counter, used for down-sampling some stuff
-  State state;    // Current state
-  State next;     // Next state
+  uint8_t epoch;     // Tick counter, the task scheduler only needs the LSB
+  uint32_t tickMs;   // Uptime at the start of this tick
+  uint16_t dtMs;     // Time since the previous tick, saturates at 0xFFFF
+  uint8_t state;     // Current State
+  uint8_t next;      // Next State
+
+  // Flags and codes
+  unsigned day : 1;           // Flag to set if day
+  unsigned motorDir : 1;      // Direction, up or down
+  unsigned door : 2;          // Door position, saved in the checkpoint
+  unsigned lSwitchClosed : 1; // Value of the upper limit switch
+  unsigned uButtonPushed : 1; // When UP button is pushed
+  unsigned dButtonPushed : 1; // When DOWN button is pushed
+  unsigned dumped : 1;        // Stored data was dumped while both buttons pushed
 
   // Day/Night parameters
-  bool day;         // Flag to set if day
   uint8_t dayCount; // Helper for hysteresis
 
   // Sleep parameters
-  uint8_t sleepCount; // Counter keeping how long we are sleeping
+  uint8_t sleepCount;  // Wake-ups during this sleep, for debugging
+  uint16_t sleepStart; // Uptime (LSBs) in seconds when the sleep started
 
   // Motor parameters
-  Direction motorDir;         // Up or down
-  uint8_t motorSpeed;         // The speed of the motor in percentage
-  uint32_t motorRunningCount; // Counter keeping how long the motor was running
+  uint8_t motorSpeed;        // The speed of the motor in percentage
+  uint16_t motorRunningTime; // Time in ms the motor was running, saturates
 
   // Sensor values
   uint16_t lSensorValue; // Value of the light sensor
-  uint16_t bSensorValue; // Battery sensor
-  bool lSwitchClosed;    // Value of the upper limit switch
-  bool uButtonPushed;    // When UP button is pushed
-  bool dButtonPushed;    // When DOWN button is pushed
+  uint16_t bSensorValue; // Battery sensor, the V2 board has none: always 0
 
   // Error
   uint16_t error; // Last found error value
 
 } Fsm;
 
+/* The ranges the fields above rely on */
+typedef char fsm_state_check[STATE_COUNT <= 8 ? 1 : -1]; // 1 << next in a byte
+typedef char fsm_dir_check[Up <= 1 && Down <= 1 ? 1 : -1];
+typedef char fsm_door_check[DOOR_MOVING <= 3 ? 1 : -1];
+typedef char fsm_day_count_check[DAY_COUNT <= 0xFF ? 1 : -1];
+typedef char fsm_sleep_check[MAX_SLEEP_TIME_S + 68 <= 0xFFFFU ? 1 : -1]; // Seen every ~67s
+
 #define isDay(fsm) (fsm->day)
 #define isNight(fsm) (!(isDay(fsm)))
 
 #define isLimitSwitch(fsm) (fsm->lSwitchClosed)
-#define isRunningTooLong(fsm) (fsm->motorRunningCount > MAX_MOTOR_COUNT)
+#define isRunningTooLong(fsm) (fsm->motorRunningTime > C_CONFIG_MaxMotorTime())
 
 #define isDirUp(fsm) (fsm->motorDir == Up)
 #define isDirDown(fsm) (fsm->motorDir == Down)
 
+/* Motor output of core_ramp_step(), see Core/core.h */
+#define runMotor(fsm) D_MOTOR_Run((Direction)fsm->motorDir, fsm->motorSpeed)
+
 /**
  * Execute the current state if the FSM.
+ * The handler is looked up in the table generated from fsm.pu, the next
+ * state it picks is checked against the transitions of the diagram.
  * @param fsm: pointer to the FSM
  */
 static void state_execute(Fsm *fsm);
 
 /**
- * Print out debug information for the current FSM variables.
- * This should set all status LEDs and write data to the
- * serial interface if enabled.
+ * Run the tasks that are due this tick, see tasks[].
+ * Tasks without slack (deadline 0) always run when due. Of the others only
+ * the first due one runs, the rest waits for a next tick unless it would
+ * miss its deadline.
+ * @param fsm: pointer to the FSM
+ */
+static void run_tasks(Fsm *fsm);
+
+/**
+ * Request a task to run on the next tick, even if it is not due yet.
+ * @param task: the task index
+ */
+static void request_task(uint8_t task);
+
+/**
+ * Task: read the limit switch and buttons. Runs every tick, for safety.
+ * @param fsm: pointer to the FSM
+ */
+static void task_Switches(Fsm *fsm);
+
+/**
+ * Task: read the light (or solar panel) voltage.
+ * @param fsm: pointer to the FSM
+ */
+static void task_Light(Fsm *fsm);
+
+/**
+ * Task: set the status LEDs.
  * @param fsm: pointer to the FSM
  */
-static void debug(Fsm *fsm);
+static void task_Leds(Fsm *fsm);
+
+#if DEBUG_MODE
+/**
+ * Task: write the FSM to the serial interface while awake.
+ * @param fsm: pointer to the FSM
+ */
+static void task_Telemetry(Fsm *fsm);
+#endif
+
+/**
+ * Read the buttons only, used when a button interrupt comes in between ticks.
+ * A push is latched in the next state, so even a push shorter than a tick
+ * will force the motor for at least one tick.
+ * @param fsm: pointer to the FSM
+ */
+static void read_buttons(Fsm *fsm);
 
 /**
  * Do a sanity check on the FSM data. This will set error flags depending
@@ -88,11 +145,11 @@ static void debug(Fsm *fsm);
 static void sanity_check(Fsm *fsm);
 
 /**
- * Read the input sensors like switches, light (or solar panel) voltage,
- * buttons... and store them in the FSM.
+ * Save the decisions of the FSM (day/night, door, error) in the EEPROM
+ * checkpoint. Called on state transitions only.
  * @param fsm: pointer to the FSM
  */
-static void read_input(Fsm *fsm);
+static void checkpoint(Fsm *fsm);
 
 /**
  * The buttons can be pressed at any time, check if this is the case and update
@@ -103,6 +160,13 @@ static void read_input(Fsm *fsm);
  */
 static void check_force(Fsm *fsm);
 
+/**
+ * Add the time of this tick to the motor running time.
+ * Saturates, it is only compared against C_CONFIG_MaxMotorTime().
+ * @param fsm: pointer to the FSM
+ */
+static void add_running_time(Fsm *fsm);
+
 /**
  * State function for State::Calculate
  * Takes the input values and calculates if it is currently day or night.
@@ -173,6 +237,36 @@ static void state_ForceDown(Fsm *fsm);
 Fsm fsm;
 SleepHandler sleepHandler;
 
+/* Generated tables, see FSM_Table.h */
+static void (*const stateHandlers[STATE_COUNT])(Fsm *) = FSM_HANDLER_TABLE;
+static const uint8_t stateTransitions[STATE_COUNT] = FSM_TRANSITION_TABLE;
+
+/* Scheduled tasks, in order of priority. Period and deadline are in ticks. */
+typedef struct {
+  void (*run)(Fsm *fsm); // Task function
+  uint8_t period;        // Run every this many ticks
+  uint8_t deadline;      // Ticks it may run late, 0 is never
+} Task;
+
+#define TASK_SWITCHES 0
+#define TASK_LIGHT 1
+#define TASK_LEDS 2
+#define TASK_TELEMETRY 3
+
+static const Task tasks[] = {
+    {task_Switches, 1, 0},
+    {task_Light, LIGHT_TASK_PERIOD, 4},
+    {task_Leds, LED_TASK_PERIOD, 8},
+#if DEBUG_MODE
+    {task_Telemetry, TELEMETRY_TASK_PERIOD, 32},
+#endif
+};
+
+#define TASK_COUNT (sizeof(tasks) / sizeof(tasks[0]))
+
+uint8_t taskLast[TASK_COUNT]; // Epoch (LSB) of the last run
+uint8_t taskRequests;         // Bit per task that should run on the next tick
+
 /*******************************************************************************
  *                      Public function implementation
  ******************************************************************************/
@@ -187,50 +281,150 @@ void C_FSM_Init(SleepHandler handler) {
   D_BUTTON_Dir = 1;
 
   // Setup the state
-  fsm.state = Calculate;
-  fsm.next = Calculate;
-  fsm.dayCount = DAY_COUNT; // Probably install while day?
+  fsm.state = STATE_INITIAL;
+  fsm.next = STATE_INITIAL;
+  fsm.dayCount = config.dayCount; // Probably install while day?
   fsm.sleepCount = 0;
+  fsm.sleepStart = 0;
   fsm.motorSpeed = 0;
-  fsm.motorRunningCount = 0;
+  fsm.motorRunningTime = 0;
+  fsm.tickMs = C_CLOCK_Millis();
+  fsm.dtMs = 0;
   fsm.lSensorValue = 200;
+  fsm.bSensorValue = 0;
   fsm.lSwitchClosed = false;
   fsm.uButtonPushed = false;
   fsm.dButtonPushed = false;
+  fsm.dumped = false;
   fsm.error = 0;
+  fsm.door = DOOR_UNKNOWN;
+
+  // Continue where we were before the reset, Calculate decides on the first
+  // tick again instead of waiting for the hysteresis
+  Checkpoint cp;
+  if (C_CHECKPOINT_Load(&cp)) {
+    fsm.day = cp.day;
+    fsm.dayCount = cp.dayCount > config.dayCount ? config.dayCount : cp.dayCount;
+    fsm.door = cp.door;
+    // There is no bottom sensor: a down move that a reset stopped halfway
+    // can't be finished on time from an unknown position, it would drive
+    // the door into the floor. Only up moves stop on the limit switch.
+    if (fsm.door == DOOR_MOVING && !fsm.day) {
+      fsm.door = DOOR_UNKNOWN;
+    }
+    // cp.error is not restored, sanity_check() decides on it every tick
+  }
+
+  // Read all inputs on the first tick
+  taskRequests = 0xFF;
 }
 
 /* Run the FSM one time */
 void C_FSM_Tick(void) {
-
+  uint16_t start = C_TIMING_Now();
+  uint32_t now = C_CLOCK_Millis();
+  uint32_t dt = now - fsm.tickMs;
+
+  // Real time, so a sleep tick or a late tick counts for what it took. A
+  // tick that holds a ~67s sleep is longer than 16 bits of ms, that
+  // saturates: only the motor states use dtMs and they never sleep.
+  fsm.dtMs = dt > 0xFFFF ? 0xFFFF : (uint16_t)dt;
+  fsm.tickMs = now;
   fsm.state = fsm.next;
 
-  read_input(&fsm);
+  run_tasks(&fsm);
   sanity_check(&fsm);
   check_force(&fsm);
   state_execute(&fsm);
 
+  C_TRACE_Record(fsm.state, fsm.next, fsm.motorSpeed,
+                 (fsm.lSwitchClosed ? TRACE_IN_LSWITCH : 0) |
+                     (fsm.uButtonPushed ? TRACE_IN_UBUTTON : 0) |
+                     (fsm.dButtonPushed ? TRACE_IN_DBUTTON : 0) |
+                     (fsm.day ? TRACE_IN_DAY : 0) |
+                     (fsm.motorDir == Down ? TRACE_IN_DIR_DOWN : 0),
+                 fsm.error);
+
+  D_EEPROM_Update(); // One queued log or checkpoint byte a tick
+
+  C_TIMING_Tick(start);
+
   fsm.epoch++;
 }
 
-void C_FSM_ToString(char *dst, uint8_t size) {
-
-  char state = ((char)fsm.state) + 48;
+void C_FSM_Event(Event e) {
+  switch (e) {
+  case EVENT_TICK:
+    C_FSM_Tick();
+    break;
+  case EVENT_BUTTON_UP:
+  case EVENT_BUTTON_DOWN:
+    read_buttons(&fsm);
+    break;
+  default:
+    break;
+  }
+}
 
-  snprintf(dst, size,
-           // s  is day     dayCount   sleepCount lSensor     bSensor uSensor
-           // lSwitch	   error
-           "%c,%" PRIu8 ",%" PRIu8 ",%" PRIu8 ",%" PRIu16 ",%" PRIu16 ",%" PRIu8
-           ",%" PRIu8 ",%" PRIu16 "\r\n",
-           state, fsm.day, fsm.dayCount, fsm.sleepCount, fsm.lSensorValue,
-           fsm.bSensorValue, 0, fsm.lSwitchClosed, fsm.error);
+void C_FSM_Print(void) {
+  // s, is day, dayCount, sleepCount, lSensor, bSensor, uSensor, lSwitch, error
+  C_PRINT_U16(fsm.state);
+  C_PRINT_Field(fsm.day);
+  C_PRINT_Field(fsm.dayCount);
+  C_PRINT_Field(fsm.sleepCount);
+  C_PRINT_Field(fsm.lSensorValue);
+  C_PRINT_Field(fsm.bSensorValue);
+  C_PRINT_Field(0);
+  C_PRINT_Field(fsm.lSwitchClosed);
+  C_PRINT_Field(fsm.error);
+  C_PRINT_End();
 }
 
 /*******************************************************************************
  *                      Private function implementations
  ******************************************************************************/
 
-void debug(Fsm *fsm) {
+void run_tasks(Fsm *fsm) {
+  uint8_t now = fsm->epoch;
+  bool slackUsed = false;
+
+  for (uint8_t i = 0; i < TASK_COUNT; i++) {
+    uint8_t late = (uint8_t)(now - taskLast[i]);
+    uint8_t mask = 1 << i;
+
+    if ((taskRequests & mask) == 0) {
+      if (late < tasks[i].period) {
+        continue; // Not due
+      }
+      late -= tasks[i].period;
+      if (late < tasks[i].deadline && slackUsed) {
+        continue; // Due, but it can wait for a quieter tick
+      }
+      if (late > tasks[i].deadline) {
+        C_TIMING_Missed();
+      }
+    }
+
+    tasks[i].run(fsm);
+    taskLast[i] = now;
+    taskRequests &= ~mask;
+    if (tasks[i].deadline > 0) {
+      slackUsed = true;
+    }
+  }
+}
+
+void request_task(uint8_t task) { taskRequests |= 1 << task; }
+
+void task_Switches(Fsm *fsm) {
+  fsm->lSwitchClosed = L_SWITCH_Pin == 1;
+  fsm->uButtonPushed = U_BUTTON_Pin == 1;
+  fsm->dButtonPushed = D_BUTTON_Pin == 1;
+}
+
+void task_Light(Fsm *fsm) { fsm->lSensorValue = D_ADC_ReadOnce(); }
+
+void task_Leds(Fsm *fsm) {
 
   if (isDay(fsm)) {
     LED_BLUE_Pin = 1;
@@ -245,18 +439,34 @@ void debug(Fsm *fsm) {
   }
 }
 
-void read_input(Fsm *fsm) {
+#if DEBUG_MODE
+void task_Telemetry(Fsm *fsm) {
+  if (fsm->state == Sleep) {
+    return; // The sleep handler already writes it
+  }
+  C_FSM_Print();
+}
+#endif
 
-  fsm->lSensorValue = D_ADC_ReadOnce();
+void read_buttons(Fsm *fsm) {
 
-  fsm->lSwitchClosed = L_SWITCH_Pin == 1;
   fsm->uButtonPushed = U_BUTTON_Pin == 1;
   fsm->dButtonPushed = D_BUTTON_Pin == 1;
 
-  debug(fsm);
+  if (isLimitSwitch(fsm) || (fsm->uButtonPushed && fsm->dButtonPushed)) {
+    // Leave this to check_force on the next tick
+    return;
+  }
+  if (fsm->uButtonPushed) {
+    fsm->next = ForceUp;
+  }
+  if (fsm->dButtonPushed) {
+    fsm->next = ForceDown;
+  }
 }
 
 void sanity_check(Fsm *fsm) {
+  uint16_t lastError = fsm->error;
   fsm->error = 0;
 
   if (isRunningTooLong(fsm)) {
@@ -266,20 +476,54 @@ void sanity_check(Fsm *fsm) {
     // Stop unless moving down
     fsm->error |= ERROR_LIMIT_SWITCH_CLOSED;
   }
+
+  /* A new error: keep the trace of the ticks that led to it */
+  if (fsm->error & ~lastError) {
+    C_TRACE_Freeze();
+  }
+
+  /* Only log changes, not every tick the error is there */
+  if (fsm->error != lastError) {
+    if ((fsm->error & ERROR_LIMIT_SWITCH_CLOSED) &&
+        !(lastError & ERROR_LIMIT_SWITCH_CLOSED)) {
+      C_LOG_Append(LOG_EVENT_LIMIT_SWITCH, fsm->motorDir);
+    }
+    C_LOG_Append(LOG_EVENT_ERROR, fsm->error);
+  }
+}
+
+void checkpoint(Fsm *fsm) {
+  Checkpoint cp;
+
+  cp.day = fsm->day;
+  cp.dayCount = fsm->dayCount;
+  cp.door = fsm->door;
+  cp.error = fsm->error;
+  C_CHECKPOINT_Save(&cp);
 }
 
 void check_force(Fsm *fsm) {
 
   if (isLimitSwitch(fsm)) {
       // Reverse the direction and move slowly down again
-      fsm->motorSpeed = MOTOR_HALF_SPEED;
+      fsm->motorSpeed = config.motorHalfSpeed;
       fsm->motorDir = Down;
-      D_MOTOR_Run(fsm->motorDir, fsm->motorSpeed);
+      runMotor(fsm);
 	    __delay_ms(1000);
       // Go to stop state
       fsm->state = MotorStop;
       fsm->next = MotorStop;
+  } else if (fsm->uButtonPushed && fsm->dButtonPushed) {
+    // Both buttons: dump the stored data once, don't move the door
+    if (!fsm->dumped) {
+      C_SERIES_Dump();
+      C_LOG_Dump();
+      fsm->dumped = true;
+    }
+    fsm->state = MotorStop;
   } else {
+    fsm->dumped = false;
+
     // Buttons
     if (fsm->uButtonPushed) {
       // Wait a little and check again, if both buttons pushed do a fake night
@@ -291,87 +535,77 @@ void check_force(Fsm *fsm) {
   }
 }
 
+void add_running_time(Fsm *fsm) {
+  uint16_t time = fsm->motorRunningTime + fsm->dtMs;
+
+  fsm->motorRunningTime = time < fsm->dtMs ? 0xFFFF : time;
+}
+
 void state_execute(Fsm *fsm) {
-  switch (fsm->state) {
-  case Calculate:
-    state_Calculate(fsm);
-    break;
-  case Sleep:
-    state_Sleep(fsm);
-    break;
-  case MotorStart:
-    state_MotorStart(fsm);
-    break;
-  case MotorRunning:
-    state_MotorRunning(fsm);
-    break;
-  case MotorSlow:
-    state_MotorSlow(fsm);
-    break;
-  case MotorStop:
-    state_MotorStop(fsm);
-    break;
-  case ForceUp:
-    state_ForceUp(fsm);
-    break;
-  case ForceDown:
-    state_ForceDown(fsm);
-    break;
+  uint16_t start = C_TIMING_Now();
+
+  stateHandlers[fsm->state](fsm);
+  C_TIMING_State(fsm->state, start); // Without the sleep of a Sleep state
+
+  if ((stateTransitions[fsm->state] & (1 << fsm->next)) == 0) {
+    // Not in the diagram, stay safe and stop
+    fsm->error |= ERROR_ILLEGAL_TRANSITION;
+    fsm->next = MotorStop;
+    C_TRACE_Freeze();
+  }
+
+  if (fsm->next != fsm->state) {
+    checkpoint(fsm);
   }
 }
 
 void state_Calculate(Fsm *fsm) {
-  bool changed = false;
+  uint8_t day;
+  bool changed;
 
   /* Handle state */
+  C_SERIES_Add(fsm->lSensorValue, fsm->bSensorValue);
 
   // Check the sensor values. If they are long enough in the same
   // state decide on changing from day or night.
-  if (fsm->lSensorValue < NIGHT_THRESHOLD) {
-    // Reading a nighttime value
-    if (fsm->dayCount == 0) {
-      // Counted enough nighttime values -> update
-      // Note: we get here all the time so only set changed flag when needed
-      changed = fsm->day; // When day was true this will set changed
-      fsm->day = false;
-      fsm->motorDir = Down;
-    } else {
-      changed = false;
-      fsm->dayCount--;
-    }
-  } else if (fsm->lSensorValue > DAY_THRESHOLD) {
-    // Reading a daytime values
-    if (fsm->dayCount >= DAY_COUNT) {
-      // Counted enough daytime values -> update
-      // Note: we get here all the time so only set changed flag when needed
-      changed = !fsm->day;
-      fsm->day = true;
-      fsm->motorDir = Up;
-    } else {
-      changed = false;
-      fsm->dayCount++;
-    }
-  }
+  day = core_day_night(fsm->day, &fsm->dayCount, fsm->lSensorValue,
+                       config.nightThreshold, config.dayThreshold,
+                       config.dayCount);
+  changed = day != fsm->day;
+  fsm->day = day;
 
   /* Decide on next state */
   if (changed) {
+    C_LOG_Append(LOG_EVENT_DAY_NIGHT, fsm->day);
+  }
+  if (changed || (fsm->door == DOOR_MOVING && isDay(fsm))) {
+    // Also when a reset stopped the door halfway up, finish that move
+    fsm->motorDir = isDay(fsm) ? Up : Down;
+    fsm->door = DOOR_MOVING;
 	  fsm->motorSpeed = 0;
-    fsm->motorRunningCount = 0;
+    fsm->motorRunningTime = 0;
     fsm->next = MotorStart;
   } else {
+    fsm->sleepStart = (uint16_t)C_CLOCK_Seconds();
     fsm->next = Sleep;
   }
 }
 
 void state_Sleep(Fsm *fsm) {
+  uint16_t slept;
+
   /* Handle state */
+  C_TRACE_Dump(); // Motor is stopped, so there is time to write it out
   sleepHandler();
   fsm->sleepCount++;
+  slept = (uint16_t)C_CLOCK_Seconds() - fsm->sleepStart;
 
   /* Decide on next state */
-  if (fsm->sleepCount >= SLEEP_COUNT) {
+  // Also right when a button woke us up halfway a sleep
+  if (slept >= config.sleepTime) {
     fsm->sleepCount = 0;
-    // Wake up
+    // Wake up, Calculate needs fresh values
+    request_task(TASK_LIGHT);
     fsm->next = Calculate;
   } else {
     // Stay asleep
@@ -384,11 +618,11 @@ void state_MotorStart(Fsm *fsm) {
   bool stopNow = false;
 
   /* Ramp up unless limit switch or timeout */
-  fsm->motorRunningCount++;
+  add_running_time(fsm);
   if (isLimitSwitch(fsm) || isRunningTooLong(fsm)) {
     stopNow = true;
   } else {
-    D_MOTOR_Run(fsm->motorDir, fsm->motorSpeed);
+    runMotor(fsm);
     fsm->motorSpeed++;
   }
 
@@ -396,7 +630,7 @@ void state_MotorStart(Fsm *fsm) {
   if (stopNow) {
     /* We have hit a switch, stop immediately */
     fsm->next = MotorStop;
-  } else if (fsm->motorSpeed > MOTOR_FULL_SPEED) {
+  } else if (fsm->motorSpeed > config.motorFullSpeed) {
     /* Ramped up, go to running state */
     fsm->next = MotorRunning;
   } else {
@@ -407,7 +641,7 @@ void state_MotorStart(Fsm *fsm) {
 
 void state_MotorRunning(Fsm *fsm) {
   /* Handle state */
-  fsm->motorRunningCount++;
+  add_running_time(fsm);
 
   /* Decide on next state */
   if (isRunningTooLong(fsm)) {
@@ -415,8 +649,8 @@ void state_MotorRunning(Fsm *fsm) {
     fsm->next = MotorStop;
     return;
   }
-  if (fsm->motorRunningCount > MOTOR_DOWN_FULL_CNT) {
-    // Count reached, slow down.
+  if (fsm->motorRunningTime > config.motorDownFullMs) {
+    // Time reached, slow down.
     fsm->next = MotorSlow;
     return;
   }
@@ -429,13 +663,12 @@ void state_MotorSlow(Fsm *fsm) {
   /* Handle state */
 
   if (isDirDown(fsm)) {
-    fsm->motorRunningCount++;
+    add_running_time(fsm);
   }
 
   // Slow down to half%
-  if (fsm->motorSpeed > MOTOR_HALF_SPEED) {
-    fsm->motorSpeed--;
-    D_MOTOR_Run(fsm->motorDir, fsm->motorSpeed);
+  if (core_ramp_step(&fsm->motorSpeed, config.motorHalfSpeed)) {
+    runMotor(fsm);
   }
 
   /* Decide on next state */
@@ -448,9 +681,9 @@ void state_MotorSlow(Fsm *fsm) {
   }
 
   if (isDirDown(fsm)) {
-    // No sensors at the bottom so rely on count
-    if (fsm->motorRunningCount > (MOTOR_DOWN_FULL_CNT + MOTOR_DOWN_SLOW_CNT)) {
-      // Count reached, stop.
+    // No sensors at the bottom so rely on time
+    if (fsm->motorRunningTime > (config.motorDownFullMs + config.motorDownSlowMs)) {
+      // Time reached, stop.
       fsm->next = MotorStop;
       return;
     }
@@ -463,12 +696,21 @@ void state_MotorSlow(Fsm *fsm) {
 void state_MotorStop(Fsm *fsm) {
   /* Handle state */
 
-  if (fsm->motorSpeed > 0) {
-    fsm->motorSpeed--;
-    D_MOTOR_Run(fsm->motorDir, fsm->motorSpeed);
+  if (core_ramp_step(&fsm->motorSpeed, 0)) {
+    runMotor(fsm);
+    if (fsm->motorSpeed == 0) {
+      C_LOG_Append(LOG_EVENT_MOTOR_RUN, fsm->motorRunningTime);
+      if (fsm->door == DOOR_MOVING) {
+        if (fsm->error & ERROR_MOTOR_RUN_TOO_LONG) {
+          fsm->door = DOOR_UNKNOWN; // Got stuck somewhere
+        } else {
+          fsm->door = isDay(fsm) ? DOOR_UP : DOOR_DOWN;
+        }
+      }
+    }
   } else {
 	  fsm->motorSpeed = 0;
-  	fsm->motorRunningCount = 0;
+  	fsm->motorRunningTime = 0;
   }
 
   /* Decide on next state */
@@ -483,16 +725,15 @@ void state_ForceUp(Fsm *fsm) {
 
   /* Handle state */
   fsm->motorDir = Up;
+  fsm->door = DOOR_UNKNOWN; // Moved by hand
   if (isLimitSwitch(fsm)) {
     // We went too far
     fsm->motorSpeed = 0;
   } else {
     // Ramp up
-    if (fsm->motorSpeed < 100) {
-      fsm->motorSpeed++;
-    }
+    core_ramp_step(&fsm->motorSpeed, 100);
   }
-  D_MOTOR_Run(fsm->motorDir, fsm->motorSpeed);
+  runMotor(fsm);
 
   /* Decide on next state */
   if (fsm->uButtonPushed) {
@@ -506,10 +747,9 @@ void state_ForceDown(Fsm *fsm) {
   /* Handle state */
 
   fsm->motorDir = Down;
-  if (fsm->motorSpeed < 100) {
-    fsm->motorSpeed++;
-  }
-  D_MOTOR_Run(fsm->motorDir, fsm->motorSpeed);
+  fsm->door = DOOR_UNKNOWN; // Moved by hand
+  core_ramp_step(&fsm->motorSpeed, 100);
+  runMotor(fsm);
 
   /* Decide on next state */
   if (fsm->dButtonPushed) {
@@ -3,6 +3,8 @@
 
 #include <stdint.h>
 
+#include "EVENT_Controller.h"
+
 /* This file contains all Finite State Machine functions */
 
 typedef void (*SleepHandler)(void);
@@ -17,12 +19,17 @@ void C_FSM_Init(SleepHandler handler);
 void C_FSM_Tick(void);
 
 /**
- * Get the FSM as a string.
- * Creates a comma separated string with most usefull values inside it.
- * @param dst: destination buffer to write string to
- * @param size: size of the dst buffer
+ * Handle an event from the interrupts. Only runs what the event needs:
+ * a tick runs the whole FSM, a button only reads the buttons.
+ * @param e: the event
+ */
+void C_FSM_Event(Event e);
+
+/**
+ * Write the FSM to the UART.
+ * A comma separated line with most usefull values inside it.
  */
-void C_FSM_ToString(char * dst, uint8_t size);
+void C_FSM_Print(void);
 
 #endif	/* FSM_CONTROLLER_H */
 
@@ -0,0 +1,47 @@
+/* Generated from fsm.pu by gen_fsm_table.py - do not edit! */
+
+#ifndef FSM_TABLE_H
+#define	FSM_TABLE_H
+
+/* Enumeration to keep the FSM state */
+typedef enum {
+  Calculate = 0,
+  Sleep = 1,
+  MotorStart = 2,
+  MotorRunning = 3,
+  MotorSlow = 4,
+  MotorStop = 5,
+  ForceUp = 6,
+  ForceDown = 7,
+} State;
+
+#define STATE_COUNT 8
+#define STATE_INITIAL Calculate
+
+/* State handlers, indexed by State */
+#define FSM_HANDLER_TABLE \
+  { \
+    state_Calculate, \
+    state_Sleep, \
+    state_MotorStart, \
+    state_MotorRunning, \
+    state_MotorSlow, \
+    state_MotorStop, \
+    state_ForceUp, \
+    state_ForceDown, \
+  }
+
+/* Allowed next states as bit mask (1 << State), indexed by State */
+#define FSM_TRANSITION_TABLE \
+  { \
+    0x06, /* Calculate -> Sleep, MotorStart */ \
+    0x03, /* Sleep -> Sleep, Calculate */ \
+    0x2C, /* MotorStart -> MotorStart, MotorRunning, MotorStop */ \
+    0x38, /* MotorRunning -> MotorRunning, MotorSlow, MotorStop */ \
+    0x30, /* MotorSlow -> MotorSlow, MotorStop */ \
+    0x21, /* MotorStop -> MotorStop, Calculate */ \
+    0x60, /* ForceUp -> ForceUp, MotorStop */ \
+    0xA0, /* ForceDown -> ForceDown, MotorStop */ \
+  }
+
+#endif	/* FSM_TABLE_H */
@@ -0,0 +1,150 @@
+#include <stdbool.h>
+
+#include "CLOCK_Controller.h"
+#include "LOG_Controller.h"
+#include "PRINT_Controller.h"
+
+#include "../Drivers/EEPROM_Driver.h"
+#include "../config.h"
+
+/*******************************************************************************
+ *                      Function and type definitions
+ ******************************************************************************/
+
+/**
+ * Every record takes 4 bytes:
+ *  [0] header: event type (3 MSB) and sequence number (5 LSB)
+ *  [1] time LSB, in units of 64s
+ *  [2] time MSB
+ *  [3] data
+ *
+ * Records are written round robin over the whole log region, so every cell
+ * wears equally. The sequence number counts modulo LOG_SEQ_MOD, the newest
+ * record is the last one before the sequence breaks. The header of the
+ * reused slot is erased first and written last, so a reset during a write
+ * loses the oldest record, never leaves it with the new time or data.
+ */
+#define LOG_RECORD_SIZE 4
+#define LOG_SLOTS (LOG_EEPROM_SIZE / LOG_RECORD_SIZE)
+#define LOG_SEQ_MOD 31    /* 31 so an erased header (0xFF) is never valid    */
+#define LOG_ERASED 0xFF
+
+/* Time is stored in units of 64s, 16 bits last 48 days */
+#define LOG_TIME_SHIFT 6
+
+/* Motor running time is stored in units of 256ms */
+#define LOG_MOTOR_TIME_SHIFT 8
+
+/* The sequence break is only found if the slots are not a multiple of it */
+typedef char log_slots_check[(LOG_SLOTS % LOG_SEQ_MOD) != 0 ? 1 : -1];
+
+#define slotAddress(slot) ((uint8_t)(LOG_EEPROM_START + ((slot) * LOG_RECORD_SIZE)))
+#define headerSeq(header) ((header) & 0x1F)
+#define headerEvent(header) ((header) >> 5)
+
+/**
+ * Read the header of a record.
+ * @param slot: slot index
+ */
+static uint8_t read_header(uint8_t slot);
+
+/**
+ * Read the time stamp of a record.
+ * @param slot: slot index
+ */
+static uint16_t read_time(uint8_t slot);
+
+/*******************************************************************************
+ *                      Variables
+ ******************************************************************************/
+
+uint8_t logNext;  // Slot that will be written next
+uint8_t logSeq;   // Sequence number of the next record
+uint16_t logTime; // Time of the newest record at start up, the clock adds to it
+
+/*******************************************************************************
+ *                      Public function implementation
+ ******************************************************************************/
+
+void C_LOG_Init(void) {
+  uint8_t slot = 0;
+  uint8_t header;
+
+  logNext = 0;
+  logSeq = 0;
+  logTime = 0;
+
+  // Slot 0 is also erased when a reset cut its append short after a wrap
+  while ((header = read_header(slot)) == LOG_ERASED) {
+    slot++;
+    if (slot == LOG_SLOTS) {
+      // Empty log
+      return;
+    }
+  }
+
+  // Follow the sequence until it breaks, the last one is the newest
+  while (slot + 1 < LOG_SLOTS) {
+    uint8_t next = read_header(slot + 1);
+    if (next == LOG_ERASED ||
+        headerSeq(next) != (headerSeq(header) + 1) % LOG_SEQ_MOD) {
+      break;
+    }
+    header = next;
+    slot++;
+  }
+
+  logNext = (slot + 1) % LOG_SLOTS;
+  logSeq = (headerSeq(header) + 1) % LOG_SEQ_MOD;
+  logTime = read_time(slot);
+}
+
+void C_LOG_Append(LogEvent event, uint16_t data) {
+  uint8_t address = slotAddress(logNext);
+  uint16_t time = logTime + (uint16_t)(C_CLOCK_Seconds() >> LOG_TIME_SHIFT);
+
+  if (event == LOG_EVENT_MOTOR_RUN) {
+    data >>= LOG_MOTOR_TIME_SHIFT;
+  }
+  if (data > 0xFF) {
+    data = 0xFF;
+  }
+
+  D_EEPROM_Queue(address, LOG_ERASED);
+  D_EEPROM_Queue(address + 1, (uint8_t)(time & 0xFF));
+  D_EEPROM_Queue(address + 2, (uint8_t)(time >> 8));
+  D_EEPROM_Queue(address + 3, (uint8_t)data);
+  D_EEPROM_Queue(address, (uint8_t)((event << 5) | logSeq));
+
+  logNext = (logNext + 1) % LOG_SLOTS;
+  logSeq = (logSeq + 1) % LOG_SEQ_MOD;
+}
+
+void C_LOG_Dump(void) {
+  // The oldest record is at logNext, or right after the erased slots there
+  uint8_t slot = logNext;
+
+  for (uint8_t i = 0; i < LOG_SLOTS; i++) {
+    uint8_t header = read_header(slot);
+    if (header != LOG_ERASED) {
+      C_PRINT_Str("L:");
+      C_PRINT_U16(headerEvent(header));
+      C_PRINT_Field(read_time(slot));
+      C_PRINT_Field(D_EEPROM_Read(slotAddress(slot) + 3));
+      C_PRINT_End();
+    }
+    slot = (slot + 1) % LOG_SLOTS;
+  }
+}
+
+/*******************************************************************************
+ *                      Private function implementations
+ ******************************************************************************/
+
+uint8_t read_header(uint8_t slot) { return D_EEPROM_Read(slotAddress(slot)); }
+
+uint16_t read_time(uint8_t slot) {
+  uint8_t address = slotAddress(slot);
+  return (uint16_t)D_EEPROM_Read(address + 1) |
+         ((uint16_t)D_EEPROM_Read(address + 2) << 8);
+}
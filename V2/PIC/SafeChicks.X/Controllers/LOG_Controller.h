@@ -0,0 +1,39 @@
+#ifndef LOG_CONTROLLER_H
+#define	LOG_CONTROLLER_H
+
+#include <stdint.h>
+
+/* This file contains the persistent event log, kept in the data EEPROM */
+
+/* Event types, stored in 3 bits so max 7 types (7 is reserved for erased) */
+typedef enum {
+  LOG_EVENT_BOOT = 0,         /* Controller (re)started, data is RCON         */
+  LOG_EVENT_DAY_NIGHT = 1,    /* Day/night changed, data is 1 for day         */
+  LOG_EVENT_MOTOR_RUN = 2,    /* Motor stopped, data is the running time      */
+  LOG_EVENT_LIMIT_SWITCH = 3, /* Limit switch hit, data is the motor dir      */
+  LOG_EVENT_ERROR = 4,        /* FSM error changed, data is the error value   */
+} LogEvent;
+
+/**
+ * Initialise the log. Call after C_CLOCK_Init().
+ * Scans the EEPROM to find the newest record, so appending continues where
+ * it stopped before the reset. Records are time stamped with C_CLOCK_Seconds()
+ * on top of the time of that record.
+ */
+void C_LOG_Init(void);
+
+/**
+ * Append an event to the log. This will overwrite the oldest record when the
+ * log is full. Queues 5 bytes for the EEPROM, see D_EEPROM_Update().
+ * @param event: type of the event
+ * @param data: event data, see LogEvent for its meaning
+ */
+void C_LOG_Append(LogEvent event, uint16_t data);
+
+/**
+ * Write all records, oldest first, to the UART.
+ * Every record is a line "L:type,time,data\r\n".
+ */
+void C_LOG_Dump(void);
+
+#endif	/* LOG_CONTROLLER_H */
@@ -0,0 +1,60 @@
+#include <stdbool.h>
+
+#include "PRINT_Controller.h"
+
+#include "../Drivers/UART_Driver.h"
+
+/*******************************************************************************
+ *                      Function and type definitions
+ ******************************************************************************/
+
+/* Decimal digits by repeated subtraction, the PIC18 has no divide */
+static const uint16_t powersOfTen[] = {10000, 1000, 100, 10};
+
+#define POWERS_OF_TEN (sizeof(powersOfTen) / sizeof(powersOfTen[0]))
+
+/*******************************************************************************
+ *                      Public function implementation
+ ******************************************************************************/
+
+void C_PRINT_Char(char c) { D_UART_WriteChar(c); }
+
+void C_PRINT_Str(const char *s) {
+  while (*s != '\0') {
+    D_UART_WriteChar(*s++);
+  }
+}
+
+void C_PRINT_U16(uint16_t value) {
+  bool leading = true;
+
+  for (uint8_t i = 0; i < POWERS_OF_TEN; i++) {
+    char digit = '0';
+    while (value >= powersOfTen[i]) {
+      value -= powersOfTen[i];
+      digit++;
+    }
+    if (digit != '0' || !leading) {
+      D_UART_WriteChar(digit);
+      leading = false;
+    }
+  }
+  D_UART_WriteChar((char)('0' + value)); // Units, also for 0
+}
+
+void C_PRINT_Field(uint16_t value) {
+  D_UART_WriteChar(',');
+  C_PRINT_U16(value);
+}
+
+void C_PRINT_Hex8(uint8_t value) {
+  static const char hex[] = "0123456789abcdef";
+
+  D_UART_WriteChar(hex[value >> 4]);
+  D_UART_WriteChar(hex[value & 0x0F]);
+}
+
+void C_PRINT_End(void) {
+  D_UART_WriteChar('\r');
+  D_UART_WriteChar('\n');
+}
@@ -0,0 +1,49 @@
+#ifndef PRINT_CONTROLLER_H
+#define	PRINT_CONTROLLER_H
+
+#include <stdint.h>
+
+/**
+ * This file contains the formatter for the UART lines.
+ * Values are written straight into the UART, without printf or a buffer.
+ * A line like "L:1,20,3\r\n" is written as:
+ *   C_PRINT_Str("L:"); C_PRINT_U16(1); C_PRINT_Field(20); C_PRINT_Field(3);
+ *   C_PRINT_End();
+ */
+
+/**
+ * Write one character.
+ * @param c: the character
+ */
+void C_PRINT_Char(char c);
+
+/**
+ * Write a 0 terminated string.
+ * @param s: the string
+ */
+void C_PRINT_Str(const char *s);
+
+/**
+ * Write a value in decimal, without leading zeros.
+ * @param value: the value
+ */
+void C_PRINT_U16(uint16_t value);
+
+/**
+ * Write a comma and a value in decimal.
+ * @param value: the value
+ */
+void C_PRINT_Field(uint16_t value);
+
+/**
+ * Write a byte as two lower case hex digits.
+ * @param value: the byte
+ */
+void C_PRINT_Hex8(uint8_t value);
+
+/**
+ * End the line with "\r\n".
+ */
+void C_PRINT_End(void);
+
+#endif	/* PRINT_CONTROLLER_H */
@@ -0,0 +1,137 @@
+#include <stdbool.h>
+
+#include "SERIES_Controller.h"
+#include "PRINT_Controller.h"
+
+#include "../config.h"
+
+/*******************************************************************************
+ *                      Function and type definitions
+ ******************************************************************************/
+
+/**
+ * The series is kept in SERIES_BLOCKS blocks of SERIES_BLOCK_SIZE bytes, used
+ * round robin. Every block can be decoded on its own:
+ *  - The first sample is stored as is: light LSB, MSB, battery LSB, MSB
+ *  - Next samples are stored as delta with the previous sample:
+ *    - Both deltas in [-7, 7]: one byte, light delta + 8 in the high nibble
+ *      and battery delta + 8 in the low nibble
+ *    - Otherwise: 0x00, followed by the zigzag varint of both deltas
+ *
+ * Light and battery change slowly so most samples take a single byte.
+ */
+#define SERIES_KEY_SIZE 4
+#define SERIES_MAX_SAMPLE_SIZE 7 /* Escape byte and two 3 byte varints      */
+#define SERIES_ESCAPE 0x00
+
+#define isSmallDelta(d) ((d) >= -7 && (d) <= 7)
+
+/**
+ * Start a new block, dropping the oldest when all blocks are in use.
+ * @param light: light sensor value
+ * @param battery: battery sensor value
+ */
+static void start_block(uint16_t light, uint16_t battery);
+
+/**
+ * Append a byte to the current block.
+ * @param data: byte to append
+ */
+static void put_byte(uint8_t data);
+
+/**
+ * Append a delta as zigzag varint to the current block.
+ * @param delta: the signed delta value
+ */
+static void put_varint(int16_t delta);
+
+/*******************************************************************************
+ *                      Variables
+ ******************************************************************************/
+
+uint8_t seriesData[SERIES_BLOCKS][SERIES_BLOCK_SIZE];
+uint8_t seriesUsed[SERIES_BLOCKS]; // Bytes used in each block, 0 when empty
+uint8_t seriesBlock;               // Block that is being written
+uint16_t seriesLight;              // Last stored light value
+uint16_t seriesBattery;            // Last stored battery value
+
+/*******************************************************************************
+ *                      Public function implementation
+ ******************************************************************************/
+
+void C_SERIES_Init(void) {
+  for (uint8_t b = 0; b < SERIES_BLOCKS; b++) {
+    seriesUsed[b] = 0;
+  }
+  seriesBlock = 0;
+  seriesLight = 0;
+  seriesBattery = 0;
+}
+
+void C_SERIES_Add(uint16_t light, uint16_t battery) {
+  int16_t dl = (int16_t)(light - seriesLight);
+  int16_t db = (int16_t)(battery - seriesBattery);
+
+  if (seriesUsed[seriesBlock] == 0 ||
+      seriesUsed[seriesBlock] > SERIES_BLOCK_SIZE - SERIES_MAX_SAMPLE_SIZE) {
+    start_block(light, battery);
+  } else if (isSmallDelta(dl) && isSmallDelta(db)) {
+    put_byte((uint8_t)(((dl + 8) << 4) | (db + 8)));
+  } else {
+    put_byte(SERIES_ESCAPE);
+    put_varint(dl);
+    put_varint(db);
+  }
+
+  seriesLight = light;
+  seriesBattery = battery;
+}
+
+void C_SERIES_Dump(void) {
+  uint8_t block = seriesBlock;
+
+  for (uint8_t b = 0; b < SERIES_BLOCKS; b++) {
+    // Oldest block is the one after the current one
+    block = (block + 1) % SERIES_BLOCKS;
+    if (seriesUsed[block] == 0) {
+      continue;
+    }
+
+    C_PRINT_Str("S:");
+    for (uint8_t i = 0; i < seriesUsed[block]; i++) {
+      C_PRINT_Hex8(seriesData[block][i]);
+    }
+    C_PRINT_End();
+  }
+}
+
+/*******************************************************************************
+ *                      Private function implementations
+ ******************************************************************************/
+
+void start_block(uint16_t light, uint16_t battery) {
+  if (seriesUsed[seriesBlock] != 0) {
+    seriesBlock = (seriesBlock + 1) % SERIES_BLOCKS;
+  }
+  seriesUsed[seriesBlock] = 0;
+
+  put_byte((uint8_t)(light & 0xFF));
+  put_byte((uint8_t)(light >> 8));
+  put_byte((uint8_t)(battery & 0xFF));
+  put_byte((uint8_t)(battery >> 8));
+}
+
+void put_byte(uint8_t data) {
+  seriesData[seriesBlock][seriesUsed[seriesBlock]] = data;
+  seriesUsed[seriesBlock]++;
+}
+
+void put_varint(int16_t delta) {
+  uint16_t value = ((uint16_t)delta << 1) ^ (uint16_t)(delta >> 15);
+
+  while (value >= 0x80) {
+    put_byte((uint8_t)(value | 0x80));
+    value >>= 7;
+  }
+  put_byte((uint8_t)value);
+}
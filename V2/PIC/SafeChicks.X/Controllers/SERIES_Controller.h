@@ -0,0 +1,27 @@
+#ifndef SERIES_CONTROLLER_H
+#define	SERIES_CONTROLLER_H
+
+#include <stdint.h>
+
+/* This file contains the light/battery time series, kept in RAM */
+
+/**
+ * Initialise (clear) the time series.
+ */
+void C_SERIES_Init(void);
+
+/**
+ * Add one light and battery sample to the series. When the buffer is full
+ * the oldest block of samples is dropped.
+ * @param light: light sensor value
+ * @param battery: battery sensor value
+ */
+void C_SERIES_Add(uint16_t light, uint16_t battery);
+
+/**
+ * Write all blocks, oldest first, to the UART.
+ * Every block is a line "S:" followed by the encoded bytes in hex.
+ */
+void C_SERIES_Dump(void);
+
+#endif	/* SERIES_CONTROLLER_H */
@@ -0,0 +1,155 @@
+#include "TIMING_Controller.h"
+#include "FSM_Table.h"
+#include "PRINT_Controller.h"
+
+#include "../Drivers/TMR0_Driver.h"
+#include "../Drivers/TMR1_Driver.h"
+#include "../config.h"
+
+/*******************************************************************************
+ *                      Function and type definitions
+ ******************************************************************************/
+
+/* TMR0 work period in Timer1 counts */
+#define TICK_BUDGET ((uint16_t)(TMR0_WORK_PERIOD_US / TMR1_US_PER_COUNT))
+
+/* Statistics of one measured thing */
+typedef struct {
+  uint16_t min;   // Shortest duration
+  uint16_t max;   // Longest duration
+  uint32_t sum;   // Sum of all durations, for the average
+  uint16_t count; // Number of durations, stops counting when full
+} Stat;
+
+/**
+ * Add a duration to the statistics.
+ * @param stat: the statistics
+ * @param duration: the duration
+ */
+static void add(Stat *stat, uint16_t duration);
+
+/**
+ * Write one statistics line to the UART.
+ * @param name: name of the line, 'T' or the state number
+ * @param stat: the statistics
+ * @param extra: last value on the line
+ */
+static void report(char name, Stat *stat, uint16_t extra);
+
+/*******************************************************************************
+ *                      Variables
+ ******************************************************************************/
+
+Stat timingStates[STATE_COUNT];
+Stat timingTick;
+uint16_t timingOverruns; // Ticks longer than TICK_BUDGET
+uint16_t timingMissed;   // Task deadlines missed
+uint16_t timingSleepStart; // Time stamp of C_TIMING_SleepBegin()
+uint16_t timingSlept;      // Sleep in the current tick, modulo 2^16
+
+uint16_t timingBoot[BOOT_STEPS]; // End of each boot step, 0 is not done yet
+
+/*******************************************************************************
+ *                      Public function implementation
+ ******************************************************************************/
+
+void C_TIMING_Init(void) {
+  for (uint8_t i = 0; i < STATE_COUNT; i++) {
+    timingStates[i] = (Stat){0xFFFF, 0, 0, 0};
+  }
+  timingTick = (Stat){0xFFFF, 0, 0, 0};
+  timingOverruns = 0;
+  timingMissed = 0;
+  timingSlept = 0;
+}
+
+void C_TIMING_Boot(BootStep step) {
+  if (timingBoot[step] == 0) {
+    timingBoot[step] = D_TMR1_Read();
+  }
+}
+
+void C_TIMING_BootReport(void) {
+  for (uint8_t i = 0; i < BOOT_STEPS; i++) {
+    C_PRINT_Str("B:");
+    C_PRINT_U16(i);
+    C_PRINT_Field(timingBoot[i]);
+    C_PRINT_End();
+  }
+}
+
+uint16_t C_TIMING_Now(void) { return D_TMR1_Read(); }
+
+void C_TIMING_SleepBegin(void) { timingSleepStart = D_TMR1_Read(); }
+
+void C_TIMING_SleepEnd(void) {
+  // Only the difference modulo 2^16 is needed: work = (begin - start) +
+  // (now - end) is exact even when Timer1 wrapped during the sleep
+  timingSlept += D_TMR1_Read() - timingSleepStart;
+}
+
+void C_TIMING_State(uint8_t state, uint16_t start) {
+  add(&timingStates[state], D_TMR1_Read() - start - timingSlept);
+}
+
+void C_TIMING_Tick(uint16_t start) {
+  uint16_t duration = D_TMR1_Read() - start - timingSlept;
+
+  timingSlept = 0;
+
+  add(&timingTick, duration);
+  if (duration > TICK_BUDGET && timingOverruns < 0xFFFF) {
+    timingOverruns++;
+  }
+}
+
+void C_TIMING_Missed(void) {
+  if (timingMissed < 0xFFFF) {
+    timingMissed++;
+  }
+}
+
+void C_TIMING_Report(void) {
+  report('T', &timingTick, timingOverruns);
+  C_PRINT_Str("M:");
+  C_PRINT_U16(timingMissed);
+  C_PRINT_End();
+  for (uint8_t i = 0; i < STATE_COUNT; i++) {
+    if (timingStates[i].count > 0) {
+      report((char)('0' + i), &timingStates[i], timingStates[i].count);
+    }
+  }
+}
+
+/*******************************************************************************
+ *                      Private function implementations
+ ******************************************************************************/
+
+void add(Stat *stat, uint16_t duration) {
+  if (duration < stat->min) {
+    stat->min = duration;
+  }
+  if (duration > stat->max) {
+    stat->max = duration;
+  }
+  if (stat->count < 0xFFFF) {
+    // When full the average is kept as it is
+    stat->sum += duration;
+    stat->count++;
+  }
+}
+
+void report(char name, Stat *stat, uint16_t extra) {
+  if (stat->count == 0) {
+    return;
+  }
+
+  C_PRINT_Str("P:");
+  C_PRINT_Char(name);
+  C_PRINT_Field(stat->min);
+  C_PRINT_Field((uint16_t)(stat->sum / stat->count));
+  C_PRINT_Field(stat->max);
+  C_PRINT_Field(stat->max - stat->min);
+  C_PRINT_Field(extra);
+  C_PRINT_End();
+}
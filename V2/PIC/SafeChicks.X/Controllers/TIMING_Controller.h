@@ -0,0 +1,92 @@
+#ifndef TIMING_CONTROLLER_H
+#define	TIMING_CONTROLLER_H
+
+#include <stdint.h>
+
+/**
+ * This file contains the tick and state handler timing statistics, and the
+ * boot profile. All times are in Timer1 counts of TMR1_US_PER_COUNT (32us).
+ */
+
+/* Steps of initialize(), in order, and the first FSM tick after it */
+typedef enum {
+  BOOT_OSCILLATOR = 0, /* Internal oscillator stable                       */
+  BOOT_PORTS,          /* TRIS and PORT registers                          */
+  BOOT_INTERRUPTS,     /* INT0, INT1 and priorities                        */
+  BOOT_TMR0,           /* D_TMR0_Init()                                    */
+  BOOT_MOTOR,          /* D_MOTOR_Init()                                   */
+  BOOT_UART,           /* D_UART_Init()                                    */
+  BOOT_ADC,            /* D_ADC_Init()                                     */
+  BOOT_STORAGE,        /* Clock, config, log, series and trace, from EEPROM */
+  BOOT_FSM,            /* C_FSM_Init(), with the checkpoint, and the queues */
+  BOOT_ENABLE,         /* Interrupts on, start message and boot log record */
+  BOOT_FIRST_TICK,     /* First FSM tick done, the first decision is made  */
+  BOOT_STEPS
+} BootStep;
+
+/**
+ * Initialise (clear) all statistics.
+ */
+void C_TIMING_Init(void);
+
+/**
+ * Time stamp the end of a boot step, since D_TMR1_Init(). Only the first time
+ * stamp of a step is kept.
+ * @param step: the step that is done
+ */
+void C_TIMING_Boot(BootStep step);
+
+/**
+ * Write the boot profile to the UART, a line "B:step,time\r\n" per step.
+ */
+void C_TIMING_BootReport(void);
+
+/**
+ * Get a time stamp to measure from.
+ * @return the current Timer1 count
+ */
+uint16_t C_TIMING_Now(void);
+
+/**
+ * Mark the start of the SLEEP instruction. The sleep until
+ * C_TIMING_SleepEnd() is not work, it is left out of the state and tick
+ * durations. Timer1 may wrap during the sleep, that doesn't matter.
+ */
+void C_TIMING_SleepBegin(void);
+
+/**
+ * Mark the end of the sleep, see C_TIMING_SleepBegin().
+ */
+void C_TIMING_SleepEnd(void);
+
+/**
+ * Add the duration of a state handler, from start till now. The Sleep state
+ * counts too, without the sleep itself.
+ * @param state: the state that was executed
+ * @param start: time stamp taken before the handler
+ */
+void C_TIMING_State(uint8_t state, uint16_t start);
+
+/**
+ * Add the duration of a whole FSM tick, from start till now. A tick longer
+ * than the TMR0 work period counts as an overrun. Sleep ticks count too,
+ * without the sleep itself.
+ * @param start: time stamp taken at the start of the tick
+ */
+void C_TIMING_Tick(uint16_t start);
+
+/**
+ * Count a task that ran later than its deadline. Stops counting when full.
+ */
+void C_TIMING_Missed(void);
+
+/**
+ * Write the statistics to the UART.
+ * A line "P:T,min,avg,max,jitter,overruns\r\n" for the tick, a line
+ * "M:missed\r\n" with the missed task deadlines, and a line
+ * "P:state,min,avg,max,jitter,count\r\n" for every state that ran. The
+ * jitter is max - min.
+ */
+void C_TIMING_Report(void);
+
+#endif	/* TIMING_CONTROLLER_H */
@@ -0,0 +1,57 @@
+#include "TRACE_Controller.h"
+#include "PRINT_Controller.h"
+
+/*******************************************************************************
+ *                      Function and type definitions
+ ******************************************************************************/
+
+/* The head wraps with a mask, so the size must be a power of two */
+typedef char trace_size_check[(TRACE_SIZE & (TRACE_SIZE - 1)) == 0 ? 1 : -1];
+
+/*******************************************************************************
+ *                      Variables
+ ******************************************************************************/
+
+uint8_t traceData[TRACE_SIZE][4];
+uint8_t traceHead;  // Record that will be written next, this is the oldest
+bool traceFrozen;   // No more recording until dumped
+bool traceStop;     // Freeze after the next record
+
+/*******************************************************************************
+ *                      Public function implementation
+ ******************************************************************************/
+
+void C_TRACE_Init(void) {
+  for (uint8_t i = 0; i < TRACE_SIZE; i++) {
+    traceData[i][0] = 0xFF; // Not recorded yet
+  }
+  traceHead = 0;
+  traceFrozen = false;
+  traceStop = false;
+}
+
+void C_TRACE_Freeze(void) { traceStop = true; }
+
+void C_TRACE_Dump(void) {
+  uint8_t i = traceHead;
+
+  if (!traceFrozen) {
+    return;
+  }
+
+  do {
+    uint8_t *t = traceData[i];
+    if (t[0] != 0xFF) {
+      C_PRINT_Str("T:");
+      C_PRINT_U16(t[0] >> 4);
+      C_PRINT_Field(t[0] & 0x0F);
+      C_PRINT_Field(t[1]);
+      C_PRINT_Field(t[2]);
+      C_PRINT_Field(t[3]);
+      C_PRINT_End();
+    }
+    i = (i + 1) & (TRACE_SIZE - 1);
+  } while (i != traceHead);
+
+  C_TRACE_Init();
+}
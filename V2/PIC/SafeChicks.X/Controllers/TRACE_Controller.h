@@ -0,0 +1,61 @@
+#ifndef TRACE_CONTROLLER_H
+#define	TRACE_CONTROLLER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "../config.h"
+
+/* This file contains the flight recorder: a RAM trace of the last FSM ticks */
+
+/* Bits of the inputs byte in a trace record */
+#define TRACE_IN_LSWITCH  0x01
+#define TRACE_IN_UBUTTON  0x02
+#define TRACE_IN_DBUTTON  0x04
+#define TRACE_IN_DAY      0x08
+#define TRACE_IN_DIR_DOWN 0x10
+
+extern uint8_t traceData[TRACE_SIZE][4];
+extern uint8_t traceHead;
+extern bool traceFrozen;
+extern bool traceStop;
+
+/**
+ * Record one tick. This is a macro so it stays a handful of instructions,
+ * nothing is formatted here. Does nothing while the trace is frozen.
+ * @param state: current state (4 bits)
+ * @param next: next state (4 bits)
+ * @param speed: motor speed
+ * @param inputs: TRACE_IN_* bits
+ * @param error: error value (LSB)
+ */
+#define C_TRACE_Record(state, next, speed, inputs, error)                      \
+  do {                                                                         \
+    if (!traceFrozen) {                                                        \
+      traceData[traceHead][0] = (uint8_t)(((state) << 4) | (next));            \
+      traceData[traceHead][1] = (uint8_t)(speed);                              \
+      traceData[traceHead][2] = (uint8_t)(inputs);                             \
+      traceData[traceHead][3] = (uint8_t)(error);                              \
+      traceHead = (traceHead + 1) & (TRACE_SIZE - 1);                          \
+      traceFrozen = traceStop;                                                 \
+    }                                                                          \
+  } while (0)
+
+/**
+ * Initialise (clear) the trace.
+ */
+void C_TRACE_Init(void);
+
+/**
+ * Freeze the trace after the tick that is running now is recorded.
+ */
+void C_TRACE_Freeze(void);
+
+/**
+ * When the trace is frozen, write it oldest first to the UART and start
+ * recording again. Every record is a line "T:state,next,speed,inputs,error".
+ * This is slow, only call it when the motor is stopped.
+ */
+void C_TRACE_Dump(void);
+
+#endif	/* TRACE_CONTROLLER_H */
@@ -0,0 +1,174 @@
+#include <stdbool.h>
+#include <xc.h>
+
+#include "../config.h"
+#include "EEPROM_Driver.h"
+
+/*******************************************************************************
+ *          DEFINES
+ ******************************************************************************/
+#define CRC8_POLYNOMIAL 0x07    /* x^8 + x^2 + x + 1                          */
+
+/* The indexes wrap with a mask, so the size must be a power of two */
+typedef char eeprom_queue_check
+    [(EEPROM_QUEUE_SIZE & (EEPROM_QUEUE_SIZE - 1)) == 0 ? 1 : -1];
+
+/*******************************************************************************
+ *          MACRO FUNCTIONS
+ ******************************************************************************/
+#define nextIndex(i) (((i) + 1) & (EEPROM_QUEUE_SIZE - 1))
+
+/*******************************************************************************
+ *          VARIABLES
+ ******************************************************************************/
+
+/* Bytes waiting to be written, oldest at eepromTail */
+uint8_t eepromAddress[EEPROM_QUEUE_SIZE];
+uint8_t eepromData[EEPROM_QUEUE_SIZE];
+uint8_t eepromHead = 0;
+uint8_t eepromTail = 0;
+
+/*******************************************************************************
+ *          BASIC FUNCTIONS
+ ******************************************************************************/
+
+/**
+ * Read one byte, no write may be in progress.
+ * @param address: EEPROM address
+ * @return the stored byte
+ */
+static uint8_t read_byte(uint8_t address) {
+
+    EEADR = address;
+    EECON1bits.EEPGD = 0;       /* Access data EEPROM memory                  */
+    EECON1bits.CFGS = 0;        /* Access flash/EEPROM, not config registers  */
+    EECON1bits.RD = 1;          /* Start the read, data is ready next cycle   */
+
+    return EEDATA;
+}
+
+/**
+ * Start writing one byte, no write may be in progress.
+ * @param address: EEPROM address
+ * @param data: byte to write
+ */
+static void start_write(uint8_t address, uint8_t data) {
+
+    bool gieh;
+    bool giel;
+
+    EEADR = address;
+    EEDATA = data;
+    EECON1bits.EEPGD = 0;       /* Access data EEPROM memory                  */
+    EECON1bits.CFGS = 0;        /* Access flash/EEPROM, not config registers  */
+    EECON1bits.WREN = 1;        /* Allow write cycles                         */
+
+    /* The unlock sequence must not be interrupted */
+    gieh = INTCONbits.GIEH;
+    giel = INTCONbits.GIEL;
+    INTCONbits.GIEH = 0;
+    INTCONbits.GIEL = 0;
+
+    EECON2 = 0x55;
+    EECON2 = 0xAA;
+    EECON1bits.WR = 1;          /* Start the write                            */
+
+    INTCONbits.GIEL = giel;
+    INTCONbits.GIEH = gieh;
+}
+
+/**
+ * Wait until the write in progress is done.
+ */
+static void wait_write(void) {
+
+    while (EECON1bits.WR);      /* Cleared by hardware when done              */
+}
+
+/*******************************************************************************
+ *          DRIVER FUNCTIONS
+ ******************************************************************************/
+
+uint8_t D_EEPROM_Read(uint8_t address) {
+
+    D_EEPROM_Flush();
+    return read_byte(address);
+}
+
+void D_EEPROM_Write(uint8_t address, uint8_t data) {
+
+    D_EEPROM_Queue(address, data);
+    D_EEPROM_Flush();
+}
+
+void D_EEPROM_Queue(uint8_t address, uint8_t data) {
+
+    uint8_t next = nextIndex(eepromHead);
+
+    while (next == eepromTail) {
+        /* Full, make room */
+        wait_write();
+        D_EEPROM_Update();
+    }
+
+    eepromAddress[eepromHead] = address;
+    eepromData[eepromHead] = data;
+    eepromHead = next;
+}
+
+void D_EEPROM_Update(void) {
+
+    if (EECON1bits.WR) {
+        return;                 /* Still writing                              */
+    }
+    EECON1bits.WREN = 0;        /* Inhibit write cycles again                 */
+    PIR2bits.EEIF = 0;          /* Clear the write complete flag              */
+
+    while (eepromTail != eepromHead) {
+        uint8_t address = eepromAddress[eepromTail];
+        uint8_t data = eepromData[eepromTail];
+
+        eepromTail = nextIndex(eepromTail);
+        if (read_byte(address) != data) {
+            start_write(address, data);
+            return;
+        }
+        /* Nothing to do, don't wear the cell */
+    }
+}
+
+void D_EEPROM_Flush(void) {
+
+    do {
+        wait_write();
+        D_EEPROM_Update();
+    } while (EECON1bits.WR);
+}
+
+uint8_t D_EEPROM_Crc8Add(uint8_t crc, uint8_t data) {
+
+    crc ^= data;
+    for (uint8_t bit = 0; bit < 8; bit++) {
+        if (crc & 0x80) {
+            crc = (uint8_t)((crc << 1) ^ CRC8_POLYNOMIAL);
+        } else {
+            crc <<= 1;
+        }
+    }
+
+    return crc;
+}
+
+uint8_t D_EEPROM_Crc8(uint8_t address, uint8_t size) {
+
+    uint8_t crc = 0x00;
+
+    D_EEPROM_Flush();
+    while (size > 0) {
+        crc = D_EEPROM_Crc8Add(crc, read_byte(address));
+        address++;
+        size--;
+    }
+
+    return crc;
+}
@@ -0,0 +1,75 @@
+/* 
+ * File:   EEPROM_Driver.h
+ * Author: thys_
+ *
+ * Driver for the 256 byte data EEPROM of the PIC18F2550.
+ */
+
+#ifndef EEPROM_DRIVER_H
+#define	EEPROM_DRIVER_H
+
+#include <stdint.h>
+
+/**
+ * A byte write takes ~4ms, half an FSM tick. Writes from the FSM are queued
+ * and D_EEPROM_Update() starts one per tick, without waiting for it. The
+ * queue is written in order, so a block that is invalidated first and made
+ * valid last stays that way.
+ */
+#define EEPROM_QUEUE_SIZE 32 /* Power of two, holds EEPROM_QUEUE_SIZE - 1 bytes */
+
+/**
+ * Read one byte from the data EEPROM. Writes the queue first (blocks ~4ms a
+ * byte), so the byte is never older than a queued write.
+ * @param address: EEPROM address (0x00 - 0xFF)
+ * @return the stored byte, 0xFF when erased
+ */
+uint8_t D_EEPROM_Read(uint8_t address);
+
+/**
+ * Write one byte to the data EEPROM. Writes the queue first and blocks until
+ * this write is done as well (~4ms a byte).
+ * The write is skipped when the byte already holds this value, to save wear.
+ * @param address: EEPROM address (0x00 - 0xFF)
+ * @param data: byte to write
+ */
+void D_EEPROM_Write(uint8_t address, uint8_t data);
+
+/**
+ * Queue one byte for the data EEPROM, D_EEPROM_Update() writes it. Only
+ * blocks when the queue is full, until the oldest write is done.
+ * The write is skipped when the byte already holds this value, to save wear.
+ * @param address: EEPROM address (0x00 - 0xFF)
+ * @param data: byte to write
+ */
+void D_EEPROM_Queue(uint8_t address, uint8_t data);
+
+/**
+ * Finish the last write when it is done, and start the next queued one that
+ * changes a byte. Never waits for a write, call once every tick.
+ */
+void D_EEPROM_Update(void);
+
+/**
+ * Write the whole queue, blocks until it is done (~4ms a byte). Call before
+ * a long sleep, the queue is not written while the ticks are stopped.
+ */
+void D_EEPROM_Flush(void);
+
+/**
+ * Add a byte to a CRC-8 (polynomial 0x07), for a block that is still queued.
+ * @param crc: CRC of the bytes before, 0x00 to start
+ * @param data: the byte
+ * @return the CRC including data
+ */
+uint8_t D_EEPROM_Crc8Add(uint8_t crc, uint8_t data);
+
+/**
+ * Calculate the CRC-8 (polynomial 0x07) of a range of the data EEPROM.
+ * @param address: first EEPROM address
+ * @param size: number of bytes
+ * @return the CRC
+ */
+uint8_t D_EEPROM_Crc8(uint8_t address, uint8_t size);
+
+#endif	/* EEPROM_DRIVER_H */
@@ -14,6 +14,7 @@
 /*******************************************************************************
  *          VARIABLES
  ******************************************************************************/
+uint8_t tmr0Mode = TIMER_MODE_WORK;
 
 
 /*******************************************************************************
@@ -27,6 +28,7 @@
 void D_TMR0_Init(uint8_t mode) {  
     
     D_TMR0_Enable(false);
+    tmr0Mode = mode;
     
     T0CONbits.T0CS = 0;             /* Internal instruction cycle clock (CLKO)*/
     T0CONbits.PSA = 0;              /* Timer0 pre-scaler is assigned.         */
@@ -37,7 +39,7 @@ void D_TMR0_Init(uint8_t mode) {
         /** 
         * 1MHz clock, 8-bit, 1:8 pre-scale
         * FOSC/4 = 250kHz = 4us
-        * 255 * 4E-6 * 8 = 8,16 ms period
+        * 256 * 4E-6 * 8 = 8,192 ms period, TMR0_WORK_PERIOD_US
         */
         
         T0CONbits.T08BIT = 1;       /* Timer0 is configured as an  8-bit timer*/
@@ -47,7 +49,7 @@ void D_TMR0_Init(uint8_t mode) {
         /** 
         * 1MHz clock, 16-bit, 1:256 pre-scale
         * FOSC/4 = 250kHz = 4us
-        * 65535 * 4E-6 * 256 = 1:10min period
+        * 65536 * 4E-6 * 256 = 67,1s period
         */
     
         T0CONbits.T08BIT = 0;       /* Timer0 is configured as an 16-bit timer*/
@@ -59,6 +61,18 @@ void D_TMR0_Init(uint8_t mode) {
     
 }
 
+uint8_t D_TMR0_Mode(void) {
+    return tmr0Mode;
+}
+
+uint16_t D_TMR0_Read(void) {
+    uint8_t low = TMR0L;            /* Reading TMR0L latches TMR0H            */
+    if (tmr0Mode == TIMER_MODE_WORK) {
+        return low;
+    }
+    return ((uint16_t)TMR0H << 8) | low;
+}
+
 void D_TMR0_Enable(bool enable) {
     if(enable) {
         INTCONbits.TMR0IF = 0;      /* Clear the interrupt flag               */
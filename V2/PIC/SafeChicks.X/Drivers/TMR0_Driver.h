@@ -6,6 +6,7 @@
  */
 
 #include <stdbool.h>
+#include <stdint.h>
 
 #ifndef TMR0_DRIVER_H
 #define	TMR0_DRIVER_H
@@ -13,12 +14,30 @@
 #define TIMER_MODE_SLEEP 0   /* Sets up the timer in sleep (slow) mode */
 #define TIMER_MODE_WORK  1   /* Sets up the timer in work (fast) mode */
 
+/* Work mode period, the FSM tick: 256 counts of 4us * 8 = 8,192ms. The clock,
+ * the timing statistics and wcet.py all take the tick length from here. */
+#define TMR0_WORK_COUNTS    256     /* 8-bit, overflows after 256 counts  */
+#define TMR0_WORK_PRESCALE  8       /* 1:8 pre-scale                      */
+#define TMR0_WORK_PERIOD_US (TMR0_WORK_COUNTS * TMR0_WORK_PRESCALE * 4UL)
+
 /**
 * Initialises all the parameters to the default setting, as well as writing the
 * tri-state registers. 
 */
 void D_TMR0_Init(uint8_t mode);
 
+/**
+ * Get the mode Timer0 was initialised in.
+ * @return TIMER_MODE_SLEEP or TIMER_MODE_WORK
+ */
+uint8_t D_TMR0_Mode(void);
+
+/**
+ * Read the current Timer0 count, 8-bit in work mode and 16-bit in sleep mode.
+ * @return the count
+ */
+uint16_t D_TMR0_Read(void);
+
 /**
  * Enable the Timer 0 module
  * @param enable Enable or disable.
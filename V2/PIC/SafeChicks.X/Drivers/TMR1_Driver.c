@@ -0,0 +1,44 @@
+#include <xc.h>
+
+#include "../config.h"
+#include "TMR1_Driver.h"
+
+/*******************************************************************************
+ *          DEFINES
+ ******************************************************************************/
+
+/*******************************************************************************
+ *          MACRO FUNCTIONS
+ ******************************************************************************/
+
+/*******************************************************************************
+ *          VARIABLES
+ ******************************************************************************/
+
+/*******************************************************************************
+ *          BASIC FUNCTIONS
+ ******************************************************************************/
+
+/*******************************************************************************
+ *          DRIVER FUNCTIONS
+ ******************************************************************************/
+void D_TMR1_Init(void) {
+
+    T1CONbits.TMR1ON = 0;           /* Stops Timer1                           */
+    T1CONbits.RD16 = 1;             /* 16-bit read/write in one operation     */
+    T1CONbits.T1CKPS = 0b11;        /* 1:8 pre-scale value                    */
+    T1CONbits.T1OSCEN = 0;          /* Timer1 oscillator is off               */
+    T1CONbits.TMR1CS = 0;           /* Internal clock (FOSC/4)                */
+
+    TMR1H = 0x00;
+    TMR1L = 0x00;
+
+    PIE1bits.TMR1IE = 0;            /* No interrupt, we only read it          */
+    PIR1bits.TMR1IF = 0;
+    T1CONbits.TMR1ON = 1;           /* Start Timer1                           */
+}
+
+uint16_t D_TMR1_Read(void) {
+    uint8_t low = TMR1L;            /* Reading TMR1L latches TMR1H (RD16)     */
+    return ((uint16_t)TMR1H << 8) | low;
+}
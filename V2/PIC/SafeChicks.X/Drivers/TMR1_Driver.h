@@ -0,0 +1,27 @@
+/* 
+ * File:   TMR1_Driver.h
+ * Author: thys_
+ *
+ * Timer1 is used as a free running time base, for measurements only.
+ */
+
+#ifndef TMR1_DRIVER_H
+#define	TMR1_DRIVER_H
+
+#include <stdint.h>
+
+#define TMR1_US_PER_COUNT 32 /* FOSC/4 = 250kHz = 4us, 1:8 pre-scale       */
+
+/**
+* Initialise and start Timer1 as a free running 16-bit counter, no interrupt.
+* It wraps every 65536 * 32us = 2,1s.
+*/
+void D_TMR1_Init(void);
+
+/**
+ * Read the current Timer1 count.
+ * @return count in steps of TMR1_US_PER_COUNT
+ */
+uint16_t D_TMR1_Read(void);
+
+#endif	/* TMR1_DRIVER_H */
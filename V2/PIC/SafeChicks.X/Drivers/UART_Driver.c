@@ -1,4 +1,3 @@
-#include <stdio.h>
 #include <stdint.h>
 #include <xc.h>
 
@@ -54,29 +53,35 @@ void D_UART_Init(void) {
     SPBRGH = 0;
     SPBRG = ((_XTAL_FREQ/1200)/64)-1; // Baud rate selection
     
-//    // Interrupts for reading
-//    if (interrupts) {
-//        RCONbits.IPEN = 1;   // Enable priority levels on interrupts
-//        INTCONbits.GIEH = 1; // Enable high interrupt
-//        INTCONbits.GIEL = 1; // Enable low interrupt
-//        PIR1bits.RCIF = 0; // Clear flag
-//        IPR1bits.RCIP = 1; // High priority
-//        PIE1bits.RCIE = 1; // Enable UART interrupt
-//    }
+    // Interrupts for reading, low priority like the tick
+    PIR1bits.RCIF = 0; // Clear flag
+    IPR1bits.RCIP = 0; // Low priority
+    PIE1bits.RCIE = 1; // Enable UART receive interrupt
 }
 
 void D_UART_Write(const char* data) {
-    printf("%s", data);
+    while (*data != '\0') {
+        D_UART_WriteChar(*data++);
+    }
     __delay_ms(1);
 }
 
-//READ_Data D_UART_Read(){
-//    readData.sender = readBuffer.sender;
-//    readData.command = readBuffer.command;
-//    readData.message = readBuffer.message;
-//    readData.ackId = readBuffer.readId;
-//    return readData;
-//}
+bool D_UART_Read(uint8_t *data) {
+    // Overrun error (can be cleared by clearing bit CREN)
+    if (RCSTAbits.OERR == 1) {
+        RCSTAbits.CREN = 0;
+        RCSTAbits.CREN = 1;
+        *data = RCREG;
+        return false;
+    }
+    // Framing error (cleared by reading the RCREG register)
+    if (RCSTAbits.FERR == 1) {
+        *data = RCREG;
+        return false;
+    }
+    *data = RCREG;
+    return true;
+}
 
 void D_UART_Enable(bool enable) {
     if(enable) {
@@ -89,14 +94,14 @@ void D_UART_Enable(bool enable) {
         
     } else {
         UART_TX_Dir = 0;
-        UART_RX_Dir = 0;
+        UART_RX_Dir = 1; // Never drive the line the other side drives
         TXSTAbits.TXEN = 0; // Deactivate TX
         RCSTAbits.CREN = 0; // Deactivate RX
         RCSTAbits.SPEN = 0; // Enable UART
     }
 }
 
-void putch(char data) {
+void D_UART_WriteChar(char data) {
     uint8_t max = 0;
     // Wait while buffer is still full
     while(TXSTAbits.TRMT == 0 && max < 200) {
@@ -105,22 +110,3 @@ void putch(char data) {
     } 
     TXREG = data;
 }
-
-//void interrupt HighISR(void) {
-//    if (PIR1bits.RC1IF) {
-//        PIR1bits.RC1IF = 0;
-//        
-//        // Framing error (can be updated by reading RCREG register and receiving next valid byte)
-//        if(RCSTAbits.FERR == 1) {
-//            RCREG = 0x00; 
-//            return;
-//        }
-//        // Overrun error (can be cleared by clearing bit CREN)
-//        if(RCSTAbits.OERR == 1) {
-//            RCSTAbits.CREN = 0;
-//            RCSTAbits.CREN = 1;
-//            return;
-//        }
-//        fillDataBuffer(RCREG);
-//    }
-//}
@@ -2,6 +2,7 @@
 #define	UART_DRIVER_H
     
 #include <stdbool.h>
+#include <stdint.h>
     
 /**
 * Initializes all the parameters to the default setting, as well as writing the
@@ -10,17 +11,26 @@
 */
 void D_UART_Init(void);
 
+/**
+ * Write one character to the TX pin of UART module. Waits (max ~1ms) for the
+ * transmit register to be free.
+ * @param data: the character
+ */
+void D_UART_WriteChar(char data);
+
 /**
  * Write data to the TX pin of UART module. 
  * @param data: Date string to write, should be 0 terminalted!
  */
 void D_UART_Write(const char* data);
 
-///**
-// * Read data from the RX pin of UART module.
-// * @return data: returns the data struct.
-// */
-//READ_Data D_UART_Read();
+/**
+ * Read a received byte from the UART module, clears the receive interrupt.
+ * Call when PIR1bits.RCIF is set.
+ * @param data: the received byte
+ * @return false on a framing or overrun error, the byte is not valid then
+ */
+bool D_UART_Read(uint8_t *data);
 
 /**
  * Enable the UART module
@@ -5,19 +5,7 @@
 
 #define _XTAL_FREQ 1000000UL /* 1 MHz clock */
 #define DEBUG_MODE 0
-
-#define PRIu8 "hhu"
-#define PRId8 "hhd"
-#define PRIx8 "hhx"
-#define PRIu16 "hu"
-#define PRId16 "hd"
-#define PRIx16 "hx"
-#define PRIu32 "lu"
-#define PRId32 "dl"
-#define PRIx32 "x"
-#define PRIu64 "llu" // or possibly "lu"
-#define PRId64 "lld" // or possibly "ld"
-#define PRIx64 "llx" // or possibly "lx"
+#define FAST_BOOT  1 /* Skip the start up delays, decide on the first tick    */
 
 
 /*******************************************************************************
@@ -47,11 +35,11 @@
 #define LED_RED_Dir     TRISBbits.TRISB5
 
 // Ports for UART
-#define UART_TX         PORTCbits.RC7
-#define UART_RX         PORTCbits.RC6
+#define UART_TX         PORTCbits.RC6   /* TX/CK, pin 17 (SER_TX)           */
+#define UART_RX         PORTCbits.RC7   /* RX/DT, pin 18 (SER_RX)           */
     
-#define UART_TX_Dir     TRISCbits.TRISC7
-#define UART_RX_Dir     TRISCbits.TRISC6
+#define UART_TX_Dir     TRISCbits.TRISC6
+#define UART_RX_Dir     TRISCbits.TRISC7
 
 /*******************************************************************************
  *                      ERROR CODES 
@@ -60,10 +48,13 @@ const uint8_t   ERROR_LIMIT_SWITCH_CLOSED = 1;
 const uint8_t   ERROR_SENSORS_UP_WHILE_NIGHT = 2;
 const uint8_t   ERROR_SENSORS_DOWN_WHILE_DAY = 4;
 const uint8_t   ERROR_MOTOR_RUN_TOO_LONG = 8;
+const uint8_t   ERROR_ILLEGAL_TRANSITION = 16;
 
 /*******************************************************************************
  *                      THRESHOLD VALUES 
  ******************************************************************************/
+/* Defaults, the values in use can be changed over the UART and are kept in
+ * the EEPROM config block, see Controllers/CONFIG_Controller.h */
 #define SECONDS_IN_MINUTE 60
 #define MILLIS_IN_SECOND  1000
 
@@ -71,21 +62,67 @@ const uint8_t   ERROR_MOTOR_RUN_TOO_LONG = 8;
 #define DAY_THRESHOLD     200
 #define NIGHT_THRESHOLD   200
 
-#define SLEEP_COUNT   5   /* The total sleep time will be SLEEP_TIME_MS times this value, to allow shorter wakeup intervals for sanity checking */
-#define DAY_COUNT     3   /* Hysteresis counter, depending on time between sleeps this makes how long day/night should be read before changing */
+#define SLEEP_TIME_S  300 /* Time between two calculations. The MCU still wakes up every Timer0 sleep period (~67s) for sanity checking, so this is rounded up to a whole number of those */
+#define DAY_COUNT     3   /* Hysteresis counter, in calculations, so SLEEP_TIME_S sets how long day/night should be read before changing */
+#define MAX_SLEEP_TIME_S 0xF000U /* The FSM times a sleep with 16 bits        */
+
+typedef char sleep_time_check[SLEEP_TIME_S <= MAX_SLEEP_TIME_S ? 1 : -1];
+
+/*******************************************************************************
+ *                      TASK SETTINGS 
+ ******************************************************************************/
+/* Periods are in FSM ticks (8,192ms while awake), period + deadline < 256 */
+#define LIGHT_TASK_PERIOD       32  /* ~0,26s, also read when waking up       */
+#define LED_TASK_PERIOD         16  /* ~0,13s                                 */
+#define TELEMETRY_TASK_PERIOD   125 /* ~1s, DEBUG_MODE only                   */
 
 /*******************************************************************************
  *                      MOTOR SETTINGS 
  ******************************************************************************/
+/* Speeds and times are defaults as well, see THRESHOLD VALUES */
 #define CCW_DIRECTION       0   /* Counter clockwise direction                */
 #define CW_DIRECTION        1   /* Clockwise direction                        */
 
 #define MOTOR_FULL_SPEED    70  /* PWM percentage                             */
 #define MOTOR_HALF_SPEED    35  /* PWM percentage                             */
 
-#define MOTOR_DOWN_FULL_CNT 1300/* The max count the motor will run fast.     */
-#define MOTOR_DOWN_SLOW_CNT 400 /* The max count the motor will run slow.     */
-#define MAX_MOTOR_COUNT     (3*(MOTOR_DOWN_FULL_CNT + MOTOR_DOWN_SLOW_CNT))
+#define MOTOR_DOWN_FULL_MS  10650U  /* Max time the motor will run fast down.*/
+#define MOTOR_DOWN_SLOW_MS  3277U   /* Max time the motor will run slow down.*/
+#define MAX_MOTOR_TIME_MS   (3U*(MOTOR_DOWN_FULL_MS + MOTOR_DOWN_SLOW_MS))
+
+/* Motor times are logged and printed as 16-bit */
+typedef char motor_time_check[MAX_MOTOR_TIME_MS < 0xF000U ? 1 : -1];
+
+
+/*******************************************************************************
+ *                      EEPROM LAYOUT 
+ ******************************************************************************/
+#define LOG_EEPROM_START    0x00/* First EEPROM byte of the event log         */
+#define LOG_EEPROM_SIZE     224 /* Event log size                             */
+#define CHECKPOINT_EEPROM_START 0xE0 /* First EEPROM byte of the checkpoint   */
+#define CHECKPOINT_EEPROM_SIZE  16   /* Checkpoint block size                 */
+#define CONFIG_EEPROM_START 0xF0/* First EEPROM byte of the config block      */
+#define CONFIG_EEPROM_SIZE  16  /* Config block size                          */
+
+typedef char eeprom_layout_check[
+    LOG_EEPROM_START + LOG_EEPROM_SIZE <= CHECKPOINT_EEPROM_START &&
+    CHECKPOINT_EEPROM_START + CHECKPOINT_EEPROM_SIZE <= CONFIG_EEPROM_START &&
+    CONFIG_EEPROM_START + CONFIG_EEPROM_SIZE <= 256 ? 1 : -1];
+
+
+/*******************************************************************************
+ *                      TIME SERIES 
+ ******************************************************************************/
+/* One sample is stored every Calculate wake-up, and takes ~1 byte. With a
+ * Calculate every SLEEP_TIME_S (~5,5 min) that is ~260 bytes a day. */
+#define SERIES_BLOCKS       12  /* Number of independently decodable blocks   */
+#define SERIES_BLOCK_SIZE   64  /* Bytes in one block                         */
+
+
+/*******************************************************************************
+ *                      FLIGHT RECORDER 
+ ******************************************************************************/
+#define TRACE_SIZE          32  /* FSM ticks kept in the trace, power of two  */
 
 
 /*******************************************************************************
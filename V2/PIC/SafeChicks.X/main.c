@@ -4,16 +4,21 @@
 
 #include "config.h"
 
+#include "Controllers/CLOCK_Controller.h"
+#include "Controllers/CONFIG_Controller.h"
 #include "Controllers/FSM_Controller.h"
+#include "Controllers/LOG_Controller.h"
+#include "Controllers/PRINT_Controller.h"
+#include "Controllers/SERIES_Controller.h"
+#include "Controllers/TIMING_Controller.h"
+#include "Controllers/TRACE_Controller.h"
 #include "Drivers/ADC_Driver.h"
+#include "Drivers/EEPROM_Driver.h"
 #include "Drivers/MOTOR_Driver.h"
 #include "Drivers/TMR0_Driver.h"
+#include "Drivers/TMR1_Driver.h"
 #include "Drivers/UART_Driver.h"
 
-#if DEBUG_MODE
-#include <stdio.h>
-#endif
-
 
 /*******************************************************************************
  *                      Local defines
@@ -42,14 +47,14 @@ static void goToSleep(void);
  *                      Variables
  ******************************************************************************/
 bool test = false;
-volatile bool runFSM = false;
 
-#if DEBUG_MODE
-#define DEBUG_BUFFER_SIZE 100
-char debugBuffer[DEBUG_BUFFER_SIZE];
+/* One queue per interrupt priority, so each has a single producer */
+EventQueue tickEvents;   // Low priority interrupt: TMR0
+EventQueue buttonEvents; // High priority interrupt: INT0, INT1
 
+#if DEBUG_MODE
 uint8_t debugCounter = 0;
-static void buildConfigString(char *dst, uint8_t size);
+bool bootReported = false;
 
 #endif
 
@@ -58,11 +63,16 @@ static void buildConfigString(char *dst, uint8_t size);
  ******************************************************************************/
 
 void initialize(void) {
+  /* Boot profile time base, runs from the 1MHz reset clock already */
+  D_TMR1_Init();
+  C_TIMING_Init();
+
   /* Oscillators setup */
   OSCCONbits.IRCF = 0b100; /* 1MHz */
   OSCCONbits.SCS = 0b10;   /* Internal oscillator, RC_RUN power mode */
   while (OSCCONbits.IOFS == 0)
     ; /* Wait for OSC to be stable */
+  C_TIMING_Boot(BOOT_OSCILLATOR);
 
   /* Port setup */
   TRISA = 0x00;
@@ -72,6 +82,7 @@ void initialize(void) {
   PORTA = 0x00;
   PORTB = 0x00;
   PORTC = 0x00;
+  C_TIMING_Boot(BOOT_PORTS);
 
   /* Interrupt setup */
   INTCON2bits.INTEDG0 = 1; /* Interrupt on rising edge               */
@@ -86,13 +97,33 @@ void initialize(void) {
 
   RCONbits.IPEN = 1;   /* Enable priority levels on interrupts   */
   INTCONbits.PEIE = 1; /* Enable all peripheral interrupts       */
+  C_TIMING_Boot(BOOT_INTERRUPTS);
 
   /* My own code setups */
   D_TMR0_Init(TIMER_MODE_WORK);
+  C_TIMING_Boot(BOOT_TMR0);
   D_MOTOR_Init();
+  C_TIMING_Boot(BOOT_MOTOR);
   D_UART_Init();
+  C_TIMING_Boot(BOOT_UART);
   D_ADC_Init();
+  C_TIMING_Boot(BOOT_ADC);
+  C_CLOCK_Init();
+  C_CONFIG_Init();
+  C_LOG_Init();
+  C_SERIES_Init();
+  C_TRACE_Init();
+  C_TIMING_Boot(BOOT_STORAGE);
   C_FSM_Init(goToSleep);
+  C_EVENT_Init(&tickEvents);
+  C_EVENT_Init(&buttonEvents);
+  C_TIMING_Boot(BOOT_FSM);
+
+#if FAST_BOOT
+  /* Don't wait a TMR0 period for the first decision. The interrupts are
+   * still off, so main may be the producer here. */
+  C_EVENT_Push(&tickEvents, EVENT_TICK);
+#endif
 
   /* Enable stuff */
   D_TMR0_Enable(true);
@@ -101,22 +132,41 @@ void initialize(void) {
   INTCONbits.GIEL = 1; /* Enable low interrupts                  */
 
   D_UART_Write("start\n");
+  C_LOG_Append(LOG_EVENT_BOOT, RCON);
+  RCONbits.POR = 1; /* Set again so the next reset cause can be seen  */
+  RCONbits.BOR = 1;
+
+  /* Hold both buttons while powering up to dump the event log */
+  if (U_BUTTON_Pin == 1 && D_BUTTON_Pin == 1) {
+    C_LOG_Dump();
+  }
+  C_TIMING_Boot(BOOT_ENABLE);
 }
 
 void goToSleep(void) {
 
 #if DEBUG_MODE
 
-  /* Print the current configuration every 10 sleeps */
+  /* Print the boot profile once */
+  if (!bootReported) {
+    C_TIMING_BootReport();
+    bootReported = true;
+  }
+
+  /* Print the current configuration, timing and lost events every 10 sleeps */
   if (debugCounter % 10 == 0) {
-    buildConfigString(debugBuffer, DEBUG_BUFFER_SIZE);
-    D_UART_Write(debugBuffer);
+    C_CONFIG_Print();
+    C_TIMING_Report();
+    /* Events lost because a queue was full, "Q:tick,button" */
+    C_PRINT_Str("Q:");
+    C_PRINT_U16(tickEvents.dropped);
+    C_PRINT_Field(buttonEvents.dropped);
+    C_PRINT_End();
     debugCounter = 0;
   }
 
   /* Debug FSM state */
-  C_FSM_ToString(debugBuffer, DEBUG_BUFFER_SIZE);
-  D_UART_Write(debugBuffer);
+  C_FSM_Print();
 
   debugCounter++;
 
@@ -128,45 +178,50 @@ void goToSleep(void) {
 
   OSCCONbits.IDLEN = 1; /* Idle mode on SLEEP instruction         */
 
+  D_EEPROM_Flush();  /* No ticks write the queue while asleep       */
+  C_CLOCK_Catchup(); /* Keep the time of the running work period  */
   D_TMR0_Init(TIMER_MODE_SLEEP);
   D_TMR0_Enable(true);
   /* Lets go! */
+  C_TIMING_SleepBegin();
   SLEEP();
+  C_TIMING_SleepEnd();
 
-  /* Wake up again */
+  /* Wake up again, a button or UART byte may have ended the sleep early */
+  C_CLOCK_Catchup();
   D_TMR0_Init(TIMER_MODE_WORK);
   D_TMR0_Enable(true);
 }
 
-#if DEBUG_MODE
-void buildConfigString(char *dst, uint8_t size) {
-
-    snprintf(dst, size,
-        "C:%" PRIu8 ",%" PRIu8 ",%" PRIu8 ",%" PRIu8 ",%" PRIu8 ",%" PRIu8 ",%" PRIu16 ",%" PRIu16 ",%" PRIu16 "\r\n", 
-        DAY_THRESHOLD,
-        NIGHT_THRESHOLD,
-        SLEEP_COUNT,
-        DAY_COUNT,
-        MOTOR_FULL_SPEED,
-        MOTOR_HALF_SPEED,
-        MAX_MOTOR_COUNT,
-        MOTOR_DOWN_FULL_CNT,
-        MOTOR_DOWN_SLOW_CNT
-);
-
-}
-#endif
-
 int main(void) {
 
+#if !FAST_BOOT
   __delay_ms(100);
+#endif
   initialize();
+#if !FAST_BOOT
   __delay_ms(100);
+#endif
 
   while (1) {
-    if (runFSM) {
-      runFSM = false;
-      C_FSM_Tick();
+    /* Buttons first, so a push is seen by the tick that follows */
+    Event e = C_EVENT_Pop(&buttonEvents);
+    if (e == EVENT_NONE) {
+      e = C_EVENT_Pop(&tickEvents);
+      /* Ticks queued up during a stall are one late tick, not a burst: the
+       * FSM takes the real time since the last tick (dtMs) from the clock,
+       * and a ramp keeps its one step per tick */
+      while (e == EVENT_TICK && C_EVENT_Peek(&tickEvents) == EVENT_TICK) {
+        C_EVENT_Pop(&tickEvents);
+      }
+    }
+    if (e == EVENT_COMMAND) {
+      C_CONFIG_Command();
+    } else if (e != EVENT_NONE) {
+      C_FSM_Event(e);
+      if (e == EVENT_TICK) {
+        C_TIMING_Boot(BOOT_FIRST_TICK); // Only the first one is kept
+      }
     }
   }
 
@@ -176,22 +231,35 @@ int main(void) {
 void __interrupt(low_priority) _LowInterruptManager(void) {
   /* Check if TMR0 interrupt is enabled and if the interrupt flag is set */
   if (INTCONbits.TMR0IE == 1 && INTCONbits.TMR0IF == 1) {
-    runFSM = true;
+    C_CLOCK_Overflow();
+    C_EVENT_Push(&tickEvents, EVENT_TICK);
     INTCONbits.TMR0IF = 0; /* clear the TMR0 interrupt flag */
   }
+
+  /* Check if the UART receive interrupt is enabled and a byte came in */
+  if (PIE1bits.RCIE == 1 && PIR1bits.RCIF == 1) {
+    uint8_t data;
+    /* Reading clears the flag, a broken byte breaks the command line */
+    if (!D_UART_Read(&data)) {
+      data = '?';
+    }
+    if (C_CONFIG_Receive(data)) {
+      C_EVENT_Push(&tickEvents, EVENT_COMMAND);
+    }
+  }
 }
 
 void __interrupt(high_priority) _HighInterruptManager(void) {
 
   /* Check if INT0 interrupt is enabled and if the interrupt flag is set */
   if (INTCONbits.INT0IE == 1 && INTCONbits.INT0IF == 1) {
-    runFSM = true;
+    C_EVENT_Push(&buttonEvents, EVENT_BUTTON_UP);
     INTCONbits.INT0IF = 0; /* clear the INT2 interrupt flag */
   }
   
    /* Check if INT1 interrupt is enabled and if the interrupt flag is set */
   if (INTCON3bits.INT1IE == 1 && INTCON3bits.INT1IF == 1) {
-    runFSM = true;
+    C_EVENT_Push(&buttonEvents, EVENT_BUTTON_DOWN);
     INTCON3bits.INT1IF = 0; /* clear the INT2 interrupt flag */
   }
 
@@ -51,17 +51,17 @@ OBJECTDIR=build/${CND_CONF}/${IMAGE_TYPE}
 DISTDIR=dist/${CND_CONF}/${IMAGE_TYPE}
 
 # Source Files Quoted if spaced
-SOURCEFILES_QUOTED_IF_SPACED=configuration.c Controllers/FSM_Controller.c Drivers/MOTOR_Driver.c Drivers/UART_Driver.c Drivers/ADC_Driver.c Drivers/TMR0_Driver.c main.c
+SOURCEFILES_QUOTED_IF_SPACED=configuration.c Controllers/FSM_Controller.c Drivers/MOTOR_Driver.c Drivers/UART_Driver.c Drivers/ADC_Driver.c Drivers/TMR0_Driver.c Drivers/EEPROM_Driver.c Controllers/LOG_Controller.c Controllers/SERIES_Controller.c Controllers/TRACE_Controller.c Controllers/EVENT_Controller.c Drivers/TMR1_Driver.c Controllers/TIMING_Controller.c Controllers/CLOCK_Controller.c Controllers/CONFIG_Controller.c Controllers/CHECKPOINT_Controller.c Controllers/PRINT_Controller.c main.c
 
 # Object Files Quoted if spaced
-OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/configuration.p1 ${OBJECTDIR}/Controllers/FSM_Controller.p1 ${OBJECTDIR}/Drivers/MOTOR_Driver.p1 ${OBJECTDIR}/Drivers/UART_Driver.p1 ${OBJECTDIR}/Drivers/ADC_Driver.p1 ${OBJECTDIR}/Drivers/TMR0_Driver.p1 ${OBJECTDIR}/main.p1
-POSSIBLE_DEPFILES=${OBJECTDIR}/configuration.p1.d ${OBJECTDIR}/Controllers/FSM_Controller.p1.d ${OBJECTDIR}/Drivers/MOTOR_Driver.p1.d ${OBJECTDIR}/Drivers/UART_Driver.p1.d ${OBJECTDIR}/Drivers/ADC_Driver.p1.d ${OBJECTDIR}/Drivers/TMR0_Driver.p1.d ${OBJECTDIR}/main.p1.d
+OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/configuration.p1 ${OBJECTDIR}/Controllers/FSM_Controller.p1 ${OBJECTDIR}/Drivers/MOTOR_Driver.p1 ${OBJECTDIR}/Drivers/UART_Driver.p1 ${OBJECTDIR}/Drivers/ADC_Driver.p1 ${OBJECTDIR}/Drivers/TMR0_Driver.p1 ${OBJECTDIR}/Drivers/EEPROM_Driver.p1 ${OBJECTDIR}/Controllers/LOG_Controller.p1 ${OBJECTDIR}/Controllers/SERIES_Controller.p1 ${OBJECTDIR}/Controllers/TRACE_Controller.p1 ${OBJECTDIR}/Controllers/EVENT_Controller.p1 ${OBJECTDIR}/Drivers/TMR1_Driver.p1 ${OBJECTDIR}/Controllers/TIMING_Controller.p1 ${OBJECTDIR}/Controllers/CLOCK_Controller.p1 ${OBJECTDIR}/Controllers/CONFIG_Controller.p1 ${OBJECTDIR}/Controllers/CHECKPOINT_Controller.p1 ${OBJECTDIR}/Controllers/PRINT_Controller.p1 ${OBJECTDIR}/main.p1
+POSSIBLE_DEPFILES=${OBJECTDIR}/configuration.p1.d ${OBJECTDIR}/Controllers/FSM_Controller.p1.d ${OBJECTDIR}/Drivers/MOTOR_Driver.p1.d ${OBJECTDIR}/Drivers/UART_Driver.p1.d ${OBJECTDIR}/Drivers/ADC_Driver.p1.d ${OBJECTDIR}/Drivers/TMR0_Driver.p1.d ${OBJECTDIR}/Drivers/EEPROM_Driver.p1.d ${OBJECTDIR}/Controllers/LOG_Controller.p1.d ${OBJECTDIR}/Controllers/SERIES_Controller.p1.d ${OBJECTDIR}/Controllers/TRACE_Controller.p1.d ${OBJECTDIR}/Controllers/EVENT_Controller.p1.d ${OBJECTDIR}/Drivers/TMR1_Driver.p1.d ${OBJECTDIR}/Controllers/TIMING_Controller.p1.d ${OBJECTDIR}/Controllers/CLOCK_Controller.p1.d ${OBJECTDIR}/Controllers/CONFIG_Controller.p1.d ${OBJECTDIR}/Controllers/CHECKPOINT_Controller.p1.d ${OBJECTDIR}/Controllers/PRINT_Controller.p1.d ${OBJECTDIR}/main.p1.d
 
 # Object Files
-OBJECTFILES=${OBJECTDIR}/configuration.p1 ${OBJECTDIR}/Controllers/FSM_Controller.p1 ${OBJECTDIR}/Drivers/MOTOR_Driver.p1 ${OBJECTDIR}/Drivers/UART_Driver.p1 ${OBJECTDIR}/Drivers/ADC_Driver.p1 ${OBJECTDIR}/Drivers/TMR0_Driver.p1 ${OBJECTDIR}/main.p1
+OBJECTFILES=${OBJECTDIR}/configuration.p1 ${OBJECTDIR}/Controllers/FSM_Controller.p1 ${OBJECTDIR}/Drivers/MOTOR_Driver.p1 ${OBJECTDIR}/Drivers/UART_Driver.p1 ${OBJECTDIR}/Drivers/ADC_Driver.p1 ${OBJECTDIR}/Drivers/TMR0_Driver.p1 ${OBJECTDIR}/Drivers/EEPROM_Driver.p1 ${OBJECTDIR}/Controllers/LOG_Controller.p1 ${OBJECTDIR}/Controllers/SERIES_Controller.p1 ${OBJECTDIR}/Controllers/TRACE_Controller.p1 ${OBJECTDIR}/Controllers/EVENT_Controller.p1 ${OBJECTDIR}/Drivers/TMR1_Driver.p1 ${OBJECTDIR}/Controllers/TIMING_Controller.p1 ${OBJECTDIR}/Controllers/CLOCK_Controller.p1 ${OBJECTDIR}/Controllers/CONFIG_Controller.p1 ${OBJECTDIR}/Controllers/CHECKPOINT_Controller.p1 ${OBJECTDIR}/Controllers/PRINT_Controller.p1 ${OBJECTDIR}/main.p1
 
 # Source Files
-SOURCEFILES=configuration.c Controllers/FSM_Controller.c Drivers/MOTOR_Driver.c Drivers/UART_Driver.c Drivers/ADC_Driver.c Drivers/TMR0_Driver.c main.c
+SOURCEFILES=configuration.c Controllers/FSM_Controller.c Drivers/MOTOR_Driver.c Drivers/UART_Driver.c Drivers/ADC_Driver.c Drivers/TMR0_Driver.c Drivers/EEPROM_Driver.c Controllers/LOG_Controller.c Controllers/SERIES_Controller.c Controllers/TRACE_Controller.c Controllers/EVENT_Controller.c Drivers/TMR1_Driver.c Controllers/TIMING_Controller.c Controllers/CLOCK_Controller.c Controllers/CONFIG_Controller.c Controllers/CHECKPOINT_Controller.c Controllers/PRINT_Controller.c main.c
 
 
 
@@ -136,6 +136,94 @@ ${OBJECTDIR}/Drivers/TMR0_Driver.p1: Drivers/TMR0_Driver.c  nbproject/Makefile-$
 	@-${MV} ${OBJECTDIR}/Drivers/TMR0_Driver.d ${OBJECTDIR}/Drivers/TMR0_Driver.p1.d 
 	@${FIXDEPS} ${OBJECTDIR}/Drivers/TMR0_Driver.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
 	
+${OBJECTDIR}/Drivers/EEPROM_Driver.p1: Drivers/EEPROM_Driver.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/Drivers" 
+	@${RM} ${OBJECTDIR}/Drivers/EEPROM_Driver.p1.d 
+	@${RM} ${OBJECTDIR}/Drivers/EEPROM_Driver.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=pickit4   -mdfp="${DFP_DIR}/xc8"  -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gdwarf-3 -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/Drivers/EEPROM_Driver.p1 Drivers/EEPROM_Driver.c 
+	@-${MV} ${OBJECTDIR}/Drivers/EEPROM_Driver.d ${OBJECTDIR}/Drivers/EEPROM_Driver.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/Drivers/EEPROM_Driver.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/Controllers/LOG_Controller.p1: Controllers/LOG_Controller.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/Controllers" 
+	@${RM} ${OBJECTDIR}/Controllers/LOG_Controller.p1.d 
+	@${RM} ${OBJECTDIR}/Controllers/LOG_Controller.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=pickit4   -mdfp="${DFP_DIR}/xc8"  -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gdwarf-3 -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/Controllers/LOG_Controller.p1 Controllers/LOG_Controller.c 
+	@-${MV} ${OBJECTDIR}/Controllers/LOG_Controller.d ${OBJECTDIR}/Controllers/LOG_Controller.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/Controllers/LOG_Controller.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/Controllers/SERIES_Controller.p1: Controllers/SERIES_Controller.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/Controllers" 
+	@${RM} ${OBJECTDIR}/Controllers/SERIES_Controller.p1.d 
+	@${RM} ${OBJECTDIR}/Controllers/SERIES_Controller.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=pickit4   -mdfp="${DFP_DIR}/xc8"  -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gdwarf-3 -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/Controllers/SERIES_Controller.p1 Controllers/SERIES_Controller.c 
+	@-${MV} ${OBJECTDIR}/Controllers/SERIES_Controller.d ${OBJECTDIR}/Controllers/SERIES_Controller.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/Controllers/SERIES_Controller.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/Controllers/TRACE_Controller.p1: Controllers/TRACE_Controller.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/Controllers" 
+	@${RM} ${OBJECTDIR}/Controllers/TRACE_Controller.p1.d 
+	@${RM} ${OBJECTDIR}/Controllers/TRACE_Controller.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=pickit4   -mdfp="${DFP_DIR}/xc8"  -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gdwarf-3 -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/Controllers/TRACE_Controller.p1 Controllers/TRACE_Controller.c 
+	@-${MV} ${OBJECTDIR}/Controllers/TRACE_Controller.d ${OBJECTDIR}/Controllers/TRACE_Controller.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/Controllers/TRACE_Controller.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/Controllers/EVENT_Controller.p1: Controllers/EVENT_Controller.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/Controllers" 
+	@${RM} ${OBJECTDIR}/Controllers/EVENT_Controller.p1.d 
+	@${RM} ${OBJECTDIR}/Controllers/EVENT_Controller.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=pickit4   -mdfp="${DFP_DIR}/xc8"  -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gdwarf-3 -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/Controllers/EVENT_Controller.p1 Controllers/EVENT_Controller.c 
+	@-${MV} ${OBJECTDIR}/Controllers/EVENT_Controller.d ${OBJECTDIR}/Controllers/EVENT_Controller.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/Controllers/EVENT_Controller.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/Drivers/TMR1_Driver.p1: Drivers/TMR1_Driver.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/Drivers" 
+	@${RM} ${OBJECTDIR}/Drivers/TMR1_Driver.p1.d 
+	@${RM} ${OBJECTDIR}/Drivers/TMR1_Driver.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=pickit4   -mdfp="${DFP_DIR}/xc8"  -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gdwarf-3 -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/Drivers/TMR1_Driver.p1 Drivers/TMR1_Driver.c 
+	@-${MV} ${OBJECTDIR}/Drivers/TMR1_Driver.d ${OBJECTDIR}/Drivers/TMR1_Driver.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/Drivers/TMR1_Driver.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/Controllers/TIMING_Controller.p1: Controllers/TIMING_Controller.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/Controllers" 
+	@${RM} ${OBJECTDIR}/Controllers/TIMING_Controller.p1.d 
+	@${RM} ${OBJECTDIR}/Controllers/TIMING_Controller.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=pickit4   -mdfp="${DFP_DIR}/xc8"  -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gdwarf-3 -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/Controllers/TIMING_Controller.p1 Controllers/TIMING_Controller.c 
+	@-${MV} ${OBJECTDIR}/Controllers/TIMING_Controller.d ${OBJECTDIR}/Controllers/TIMING_Controller.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/Controllers/TIMING_Controller.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/Controllers/CLOCK_Controller.p1: Controllers/CLOCK_Controller.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/Controllers" 
+	@${RM} ${OBJECTDIR}/Controllers/CLOCK_Controller.p1.d 
+	@${RM} ${OBJECTDIR}/Controllers/CLOCK_Controller.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=pickit4   -mdfp="${DFP_DIR}/xc8"  -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gdwarf-3 -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/Controllers/CLOCK_Controller.p1 Controllers/CLOCK_Controller.c 
+	@-${MV} ${OBJECTDIR}/Controllers/CLOCK_Controller.d ${OBJECTDIR}/Controllers/CLOCK_Controller.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/Controllers/CLOCK_Controller.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/Controllers/CONFIG_Controller.p1: Controllers/CONFIG_Controller.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/Controllers" 
+	@${RM} ${OBJECTDIR}/Controllers/CONFIG_Controller.p1.d 
+	@${RM} ${OBJECTDIR}/Controllers/CONFIG_Controller.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=pickit4   -mdfp="${DFP_DIR}/xc8"  -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gdwarf-3 -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/Controllers/CONFIG_Controller.p1 Controllers/CONFIG_Controller.c 
+	@-${MV} ${OBJECTDIR}/Controllers/CONFIG_Controller.d ${OBJECTDIR}/Controllers/CONFIG_Controller.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/Controllers/CONFIG_Controller.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/Controllers/CHECKPOINT_Controller.p1: Controllers/CHECKPOINT_Controller.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/Controllers" 
+	@${RM} ${OBJECTDIR}/Controllers/CHECKPOINT_Controller.p1.d 
+	@${RM} ${OBJECTDIR}/Controllers/CHECKPOINT_Controller.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=pickit4   -mdfp="${DFP_DIR}/xc8"  -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gdwarf-3 -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/Controllers/CHECKPOINT_Controller.p1 Controllers/CHECKPOINT_Controller.c 
+	@-${MV} ${OBJECTDIR}/Controllers/CHECKPOINT_Controller.d ${OBJECTDIR}/Controllers/CHECKPOINT_Controller.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/Controllers/CHECKPOINT_Controller.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/Controllers/PRINT_Controller.p1: Controllers/PRINT_Controller.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/Controllers" 
+	@${RM} ${OBJECTDIR}/Controllers/PRINT_Controller.p1.d 
+	@${RM} ${OBJECTDIR}/Controllers/PRINT_Controller.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=pickit4   -mdfp="${DFP_DIR}/xc8"  -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gdwarf-3 -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/Controllers/PRINT_Controller.p1 Controllers/PRINT_Controller.c 
+	@-${MV} ${OBJECTDIR}/Controllers/PRINT_Controller.d ${OBJECTDIR}/Controllers/PRINT_Controller.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/Controllers/PRINT_Controller.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
 ${OBJECTDIR}/main.p1: main.c  nbproject/Makefile-${CND_CONF}.mk 
 	@${MKDIR} "${OBJECTDIR}" 
 	@${RM} ${OBJECTDIR}/main.p1.d 
@@ -193,6 +281,94 @@ ${OBJECTDIR}/Drivers/TMR0_Driver.p1: Drivers/TMR0_Driver.c  nbproject/Makefile-$
 	@-${MV} ${OBJECTDIR}/Drivers/TMR0_Driver.d ${OBJECTDIR}/Drivers/TMR0_Driver.p1.d 
 	@${FIXDEPS} ${OBJECTDIR}/Drivers/TMR0_Driver.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
 	
+${OBJECTDIR}/Drivers/EEPROM_Driver.p1: Drivers/EEPROM_Driver.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/Drivers" 
+	@${RM} ${OBJECTDIR}/Drivers/EEPROM_Driver.p1.d 
+	@${RM} ${OBJECTDIR}/Drivers/EEPROM_Driver.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gdwarf-3 -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/Drivers/EEPROM_Driver.p1 Drivers/EEPROM_Driver.c 
+	@-${MV} ${OBJECTDIR}/Drivers/EEPROM_Driver.d ${OBJECTDIR}/Drivers/EEPROM_Driver.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/Drivers/EEPROM_Driver.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/Controllers/LOG_Controller.p1: Controllers/LOG_Controller.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/Controllers" 
+	@${RM} ${OBJECTDIR}/Controllers/LOG_Controller.p1.d 
+	@${RM} ${OBJECTDIR}/Controllers/LOG_Controller.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gdwarf-3 -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/Controllers/LOG_Controller.p1 Controllers/LOG_Controller.c 
+	@-${MV} ${OBJECTDIR}/Controllers/LOG_Controller.d ${OBJECTDIR}/Controllers/LOG_Controller.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/Controllers/LOG_Controller.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/Controllers/SERIES_Controller.p1: Controllers/SERIES_Controller.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/Controllers" 
+	@${RM} ${OBJECTDIR}/Controllers/SERIES_Controller.p1.d 
+	@${RM} ${OBJECTDIR}/Controllers/SERIES_Controller.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gdwarf-3 -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/Controllers/SERIES_Controller.p1 Controllers/SERIES_Controller.c 
+	@-${MV} ${OBJECTDIR}/Controllers/SERIES_Controller.d ${OBJECTDIR}/Controllers/SERIES_Controller.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/Controllers/SERIES_Controller.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/Controllers/TRACE_Controller.p1: Controllers/TRACE_Controller.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/Controllers" 
+	@${RM} ${OBJECTDIR}/Controllers/TRACE_Controller.p1.d 
+	@${RM} ${OBJECTDIR}/Controllers/TRACE_Controller.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gdwarf-3 -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/Controllers/TRACE_Controller.p1 Controllers/TRACE_Controller.c 
+	@-${MV} ${OBJECTDIR}/Controllers/TRACE_Controller.d ${OBJECTDIR}/Controllers/TRACE_Controller.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/Controllers/TRACE_Controller.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/Controllers/EVENT_Controller.p1: Controllers/EVENT_Controller.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/Controllers" 
+	@${RM} ${OBJECTDIR}/Controllers/EVENT_Controller.p1.d 
+	@${RM} ${OBJECTDIR}/Controllers/EVENT_Controller.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gdwarf-3 -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/Controllers/EVENT_Controller.p1 Controllers/EVENT_Controller.c 
+	@-${MV} ${OBJECTDIR}/Controllers/EVENT_Controller.d ${OBJECTDIR}/Controllers/EVENT_Controller.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/Controllers/EVENT_Controller.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/Drivers/TMR1_Driver.p1: Drivers/TMR1_Driver.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/Drivers" 
+	@${RM} ${OBJECTDIR}/Drivers/TMR1_Driver.p1.d 
+	@${RM} ${OBJECTDIR}/Drivers/TMR1_Driver.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gdwarf-3 -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/Drivers/TMR1_Driver.p1 Drivers/TMR1_Driver.c 
+	@-${MV} ${OBJECTDIR}/Drivers/TMR1_Driver.d ${OBJECTDIR}/Drivers/TMR1_Driver.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/Drivers/TMR1_Driver.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/Controllers/TIMING_Controller.p1: Controllers/TIMING_Controller.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/Controllers" 
+	@${RM} ${OBJECTDIR}/Controllers/TIMING_Controller.p1.d 
+	@${RM} ${OBJECTDIR}/Controllers/TIMING_Controller.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gdwarf-3 -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/Controllers/TIMING_Controller.p1 Controllers/TIMING_Controller.c 
+	@-${MV} ${OBJECTDIR}/Controllers/TIMING_Controller.d ${OBJECTDIR}/Controllers/TIMING_Controller.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/Controllers/TIMING_Controller.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/Controllers/CLOCK_Controller.p1: Controllers/CLOCK_Controller.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/Controllers" 
+	@${RM} ${OBJECTDIR}/Controllers/CLOCK_Controller.p1.d 
+	@${RM} ${OBJECTDIR}/Controllers/CLOCK_Controller.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gdwarf-3 -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/Controllers/CLOCK_Controller.p1 Controllers/CLOCK_Controller.c 
+	@-${MV} ${OBJECTDIR}/Controllers/CLOCK_Controller.d ${OBJECTDIR}/Controllers/CLOCK_Controller.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/Controllers/CLOCK_Controller.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/Controllers/CONFIG_Controller.p1: Controllers/CONFIG_Controller.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/Controllers" 
+	@${RM} ${OBJECTDIR}/Controllers/CONFIG_Controller.p1.d 
+	@${RM} ${OBJECTDIR}/Controllers/CONFIG_Controller.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gdwarf-3 -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/Controllers/CONFIG_Controller.p1 Controllers/CONFIG_Controller.c 
+	@-${MV} ${OBJECTDIR}/Controllers/CONFIG_Controller.d ${OBJECTDIR}/Controllers/CONFIG_Controller.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/Controllers/CONFIG_Controller.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/Controllers/CHECKPOINT_Controller.p1: Controllers/CHECKPOINT_Controller.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/Controllers" 
+	@${RM} ${OBJECTDIR}/Controllers/CHECKPOINT_Controller.p1.d 
+	@${RM} ${OBJECTDIR}/Controllers/CHECKPOINT_Controller.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gdwarf-3 -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/Controllers/CHECKPOINT_Controller.p1 Controllers/CHECKPOINT_Controller.c 
+	@-${MV} ${OBJECTDIR}/Controllers/CHECKPOINT_Controller.d ${OBJECTDIR}/Controllers/CHECKPOINT_Controller.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/Controllers/CHECKPOINT_Controller.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/Controllers/PRINT_Controller.p1: Controllers/PRINT_Controller.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/Controllers" 
+	@${RM} ${OBJECTDIR}/Controllers/PRINT_Controller.p1.d 
+	@${RM} ${OBJECTDIR}/Controllers/PRINT_Controller.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gdwarf-3 -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/Controllers/PRINT_Controller.p1 Controllers/PRINT_Controller.c 
+	@-${MV} ${OBJECTDIR}/Controllers/PRINT_Controller.d ${OBJECTDIR}/Controllers/PRINT_Controller.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/Controllers/PRINT_Controller.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
 ${OBJECTDIR}/main.p1: main.c  nbproject/Makefile-${CND_CONF}.mk 
 	@${MKDIR} "${OBJECTDIR}" 
 	@${RM} ${OBJECTDIR}/main.p1.d 
@@ -1,29 +1,35 @@
 /*
-  Analog input, analog output, serial output
+  Solar panel logger
 
-  Reads an analog input pin, maps the result to a range from 0 to 255 and uses
-  the result to set the pulse width modulation (PWM) of an output pin.
-  Also prints the results to the Serial Monitor.
+  Reads the panel voltage on analog pin 0 once a minute. The samples are kept
+  in RAM and printed as one line every BATCH_SIZE samples, comma separated and
+  oldest first, so the Raspberry Pi only needs to listen once per batch.
 
-  The circuit:
-  - potentiometer connected to analog pin 0.
-    Center pin of the potentiometer goes to the analog pin.
-    side pins of the potentiometer go to +5V and ground
-  - LED connected from digital pin 9 to ground through 220 ohm resistor
+  Between samples the AVR is in power-down sleep, woken by the watchdog. The
+  watchdog oscillator is only accurate to about 10%, so the minute is too.
 
-  created 29 Dec. 2008
-  modified 9 Apr 2012
-  by Tom Igoe
-
-  This example code is in the public domain.
+  Based on the AnalogInOutSerial example, created 29 Dec. 2008,
+  modified 9 Apr 2012 by Tom Igoe. This example code is in the public domain.
 
   https://docs.arduino.cc/built-in-examples/analog/AnalogInOutSerial/
 */
 
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
+#include <avr/wdt.h>
+
 // These constants won't change. They're used to give names to the pins used:
-const int analogInPin = A0;  // Analog input pin that the potentiometer is attached to
+const int analogInPin = A0;  // Analog input pin that the panel is attached to
 
-int sensorValue = 0;  // analog value
+const uint8_t BATCH_SIZE = 15;  // Samples per printed line, 15 minutes
+const uint8_t SLEEP_8S_COUNT = 7;  // 7 x 8s + 4s = 1 minute between samples
+
+uint16_t samples[BATCH_SIZE];  // analog values waiting to be printed
+uint8_t sampleCount = 0;
+
+// Only wakes the CPU, the sleep continues after it
+ISR(WDT_vect) {
+}
 
 void setup() {
   // initialize serial communications at 9600 bps:
@@ -32,19 +38,58 @@ void setup() {
 
 void loop() {
   // read the analog in value:
-  sensorValue = analogRead(analogInPin);
+  samples[sampleCount++] = analogRead(analogInPin);
 
-  // print the results to the Serial Monitor:
-  Serial.println(sensorValue);
+  if (sampleCount == BATCH_SIZE) {
+    printBatch();
+    sampleCount = 0;
+  }
 
-  // wait 
+  // wait
   sleep();
 }
 
+void printBatch() {
+  for (uint8_t i = 0; i < BATCH_SIZE; i++) {
+    if (i > 0) {
+      Serial.print(',');
+    }
+    Serial.print(samples[i]);
+  }
+  Serial.println();
+  // Power-down stops the UART, send everything first
+  Serial.flush();
+}
+
 void sleep() {
-  for (int i = 0; i < 6; i++) 
+  for (uint8_t i = 0; i < SLEEP_8S_COUNT; i++)
   {
-    delay(10000);
+    powerDown(_BV(WDP3) | _BV(WDP0));  // 8s
   }
+  powerDown(_BV(WDP3));  // 4s
 }
 
+void powerDown(uint8_t prescaler) {
+  // The ADC draws current in power-down too, switch it off while asleep
+  uint8_t adc = ADCSRA;
+  ADCSRA &= ~_BV(ADEN);
+
+  // Watchdog in interrupt mode, no reset
+  cli();
+  wdt_reset();
+  MCUSR &= ~_BV(WDRF);
+  WDTCSR = _BV(WDCE) | _BV(WDE);
+  WDTCSR = _BV(WDIE) | prescaler;
+  sei();
+
+  set_sleep_mode(SLEEP_MODE_PWR_DOWN);
+  sleep_enable();
+#ifdef sleep_bod_disable
+  sleep_bod_disable();
+#endif
+  sleep_cpu();
+  sleep_disable();
+
+  wdt_disable();
+  ADCSRA = adc;
+}
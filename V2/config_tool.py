@@ -0,0 +1,85 @@
+import serial
+import argparse
+
+# Fields of a C: line, in order, as written by CONFIG_Controller.c
+FIELDS = [
+    "dayThreshold",
+    "nightThreshold",
+    "sleepTime",
+    "dayCount",
+    "motorFullSpeed",
+    "motorHalfSpeed",
+    "maxMotorTime",     # Derived, 3 * (motorDownFullMs + motorDownSlowMs)
+    "motorDownFullMs",
+    "motorDownSlowMs",
+]
+
+# Fields of a W: command, the derived one is left out
+WRITE_FIELDS = [f for f in FIELDS if f != "maxMotorTime"]
+
+RETRIES = 3
+
+
+def parse_config(line):
+    """Parse a 'C:...' line, returns None when not a config line"""
+    if not line.startswith("C:"):
+        return None
+    if line == "C:ERR":
+        raise ValueError("The controller refused the command")
+
+    parts = line.replace("C:", "").strip().split(",")
+    if len(parts) != len(FIELDS):
+        print(f"ERROR: Invalid config length: {len(parts)}")
+        return None
+    return dict(zip(FIELDS, (int(p) for p in parts)))
+
+
+def command(ser, text):
+    """Send a command line and wait for the C: reply"""
+    for _ in range(RETRIES):
+        # The newline first ends any noise the controller may have seen
+        ser.write(f"\n{text}\n".encode())
+        for _ in range(5):
+            line = ser.readline().decode(errors="ignore").strip()
+            conf = parse_config(line)
+            if conf:
+                return conf
+    raise TimeoutError("No reply from the controller")
+
+
+def print_config(conf):
+    for name in FIELDS:
+        print(f"{name:<16} {conf[name]}")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Read or change the settings stored in the controller EEPROM.")
+    parser.add_argument("--port", default="COM8", help="COM port to use (default: COM8)")
+    parser.add_argument("--baud", type=int, default=1200, help="Baud rate (default: 1200)")
+    sub = parser.add_subparsers(dest="action", required=True)
+    sub.add_parser("read", help="Show the settings in use")
+    sub.add_parser("defaults", help="Erase the stored settings, use the firmware defaults")
+    write = sub.add_parser("write", help="Change some settings, the others are kept")
+    for name in WRITE_FIELDS:
+        write.add_argument(f"--{name}", type=int)
+    args = parser.parse_args()
+
+    with serial.Serial(args.port, args.baud, timeout=2) as ser:
+        if args.action == "read":
+            conf = command(ser, "R")
+        elif args.action == "defaults":
+            conf = command(ser, "D")
+        else:
+            conf = command(ser, "R")
+            for name in WRITE_FIELDS:
+                value = getattr(args, name)
+                if value is not None:
+                    conf[name] = value
+            values = ",".join(str(conf[name]) for name in WRITE_FIELDS)
+            conf = command(ser, f"W:{values}")
+
+    print_config(conf)
+
+
+if __name__ == "__main__":
+    main()
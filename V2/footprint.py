@@ -0,0 +1,121 @@
+import argparse
+import json
+import os
+import sys
+
+import xc8_output
+
+DEFAULT_PROJECT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "PIC", "SafeChicks.X")
+DEFAULT_BASELINE = os.path.join(DEFAULT_PROJECT, "footprint-baseline.json")
+OTHER = "(library/startup)"
+
+
+def collect(project, dist):
+    """ROM and RAM bytes per C file, memory totals and stack depths of a build"""
+    outputs = xc8_output.find_outputs(dist)
+    missing = [kind for kind, path in outputs.items() if not path]
+    if missing:
+        raise FileNotFoundError(f"No {', '.join(missing)} output in {dist}, build the project first")
+
+    psects = xc8_output.parse_map_psects(outputs["map"])
+    functions, variables, depths = xc8_output.parse_asm(outputs["asm"])
+    owners = xc8_output.find_definitions(project, set(variables))
+
+    modules = {}
+
+    def add(module, kind, size):
+        modules.setdefault(module, {"rom": 0, "ram": 0})[kind] += size
+
+    for function in functions.values():
+        module = function.file or OTHER
+        add(module, "rom", psects.get(function.psect, (0, 0))[0])
+        add(module, "ram", function.ram)
+    for name, (size, _) in variables.items():
+        add(owners.get(name, OTHER), "ram", size)
+
+    memory = xc8_output.parse_memoryfile(outputs["memory"])
+    cstack = sum(length for name, (length, _) in psects.items() if name.startswith("cstack"))
+
+    return {
+        "modules": modules,
+        "memory": {name: used for name, (used, _) in memory.items()},
+        "limits": {name: length for name, (_, length) in memory.items()},
+        "cstack": cstack,
+        "stack": depths,
+    }
+
+
+def delta(new, old):
+    if old is None:
+        return "new"
+    diff = new - old
+    return f"{diff:+d}" if diff else ""
+
+
+def report(current, baseline):
+    old_modules = baseline.get("modules", {}) if baseline else {}
+
+    print(f"{'Module':<40} {'ROM':>7} {'':>7} {'RAM':>6} {'':>6}")
+    for module in sorted(set(current["modules"]) | set(old_modules)):
+        new = current["modules"].get(module, {"rom": 0, "ram": 0})
+        old = old_modules.get(module) if baseline else None
+        print(f"{module:<40} {new['rom']:>7} {delta(new['rom'], old and old['rom']):>7} "
+              f"{new['ram']:>6} {delta(new['ram'], old and old['ram']):>6}")
+
+    print()
+    for name, used in current["memory"].items():
+        old = baseline["memory"].get(name) if baseline else None
+        limit = current["limits"].get(name) or 0
+        percent = f"{100 * used / limit:.1f}%" if limit else ""
+        print(f"{name + ' memory':<40} {used:>7} {delta(used, old):>7}  of {limit} {percent}")
+
+    old = baseline.get("cstack") if baseline else None
+    print(f"{'Compiled stack (RAM)':<40} {current['cstack']:>7} {delta(current['cstack'], old):>7}")
+
+    print()
+    for root, depth in current["stack"].items():
+        old = baseline.get("stack", {}).get(root) if baseline else None
+        warning = "  OVER THE HARDWARE STACK" if depth > xc8_output.HARDWARE_STACK_LEVELS else ""
+        print(f"Stack depth from {root:<23} {depth:>7} {delta(depth, old):>7}  of {xc8_output.HARDWARE_STACK_LEVELS} levels{warning}")
+
+
+def growth(current, baseline):
+    """Bytes of program and data memory added since the baseline"""
+    if not baseline:
+        return 0
+    return sum(max(0, used - baseline["memory"].get(name, used)) for name, used in current["memory"].items())
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Report ROM/RAM per module and stack depth of the last XC8 build, compared to a stored baseline.")
+    parser.add_argument("--project", default=DEFAULT_PROJECT, help="MPLAB X project directory (default: SafeChicks.X)")
+    parser.add_argument("--dist", help="Build output directory (default: <project>/dist/default/production)")
+    parser.add_argument("--baseline", default=DEFAULT_BASELINE, help="Baseline JSON file")
+    parser.add_argument("--save", action="store_true", help="Store this build as the new baseline")
+    parser.add_argument("--max-growth", type=int, help="Fail when program plus data memory grew more than this many bytes")
+    args = parser.parse_args()
+
+    dist = args.dist or os.path.join(args.project, "dist", "default", "production")
+    current = collect(args.project, dist)
+
+    baseline = None
+    if os.path.exists(args.baseline):
+        with open(args.baseline) as f:
+            baseline = json.load(f)
+    else:
+        print(f"No baseline at {args.baseline}, run with --save to store one\n")
+
+    report(current, baseline)
+
+    if args.save:
+        with open(args.baseline, "w") as f:
+            json.dump(current, f, indent=2, sort_keys=True)
+        print(f"\nBaseline saved to {args.baseline}")
+
+    too_deep = any(depth > xc8_output.HARDWARE_STACK_LEVELS for depth in current["stack"].values())
+    if too_deep or (args.max_growth is not None and growth(current, baseline) > args.max_growth):
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
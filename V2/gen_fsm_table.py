@@ -0,0 +1,122 @@
+import argparse
+import re
+import sys
+from pathlib import Path
+
+ROOT = Path(__file__).resolve().parent.parent
+DIAGRAM = ROOT / "fsm.pu"
+OUTPUT = ROOT / "V2" / "PIC" / "SafeChicks.X" / "Controllers" / "FSM_Table.h"
+
+STATE_DESC = re.compile(r"^(\w+)\s*:")
+PSEUDO_STATE = re.compile(r"^state\s+(\w+)\s+<<start>>")
+TRANSITION = re.compile(r"^(\w+)\s*-+>\s*(\w+)")
+
+
+def parse_diagram(text):
+    """Returns the states (in order) and the transitions as (from, to) tuples.
+    Transitions that start in a <<start>> pseudo state are entry points."""
+    states = []
+    pseudo = set()
+    transitions = []
+    entries = []
+
+    for line in text.splitlines():
+        line = line.strip()
+        if not line or line.startswith("'") or line.startswith("@") or line.startswith("note"):
+            continue
+
+        m = PSEUDO_STATE.match(line)
+        if m:
+            pseudo.add(m.group(1))
+            continue
+
+        m = TRANSITION.match(line)
+        if m:
+            transitions.append((m.group(1), m.group(2)))
+            continue
+
+        m = STATE_DESC.match(line)
+        if m and m.group(1) not in states:
+            states.append(m.group(1))
+
+    table = []
+    for src, dst in transitions:
+        if dst not in states:
+            raise ValueError(f"Transition to unknown state '{dst}'")
+        if src in pseudo:
+            entries.append((src, dst))
+        elif src in states:
+            table.append((src, dst))
+        else:
+            raise ValueError(f"Transition from unknown state '{src}'")
+
+    if len(states) > 8:
+        raise ValueError("Transitions are stored as a byte, max 8 states")
+
+    return states, table, entries
+
+
+def generate(states, table, entries):
+    out = []
+    out.append("/* Generated from fsm.pu by gen_fsm_table.py - do not edit! */")
+    out.append("")
+    out.append("#ifndef FSM_TABLE_H")
+    out.append("#define\tFSM_TABLE_H")
+    out.append("")
+    out.append("/* Enumeration to keep the FSM state */")
+    out.append("typedef enum {")
+    for i, state in enumerate(states):
+        out.append(f"  {state} = {i},")
+    out.append("} State;")
+    out.append("")
+    out.append(f"#define STATE_COUNT {len(states)}")
+    initial = [dst for src, dst in entries if src == "start"]
+    if initial:
+        out.append(f"#define STATE_INITIAL {initial[0]}")
+    out.append("")
+    out.append("/* State handlers, indexed by State */")
+    out.append("#define FSM_HANDLER_TABLE \\")
+    out.append("  { \\")
+    for state in states:
+        out.append(f"    state_{state}, \\")
+    out.append("  }")
+    out.append("")
+    out.append("/* Allowed next states as bit mask (1 << State), indexed by State */")
+    out.append("#define FSM_TRANSITION_TABLE \\")
+    out.append("  { \\")
+    for state in states:
+        mask = 0
+        targets = []
+        for src, dst in table:
+            if src == state and dst not in targets:
+                mask |= 1 << states.index(dst)
+                targets.append(dst)
+        out.append(f"    0x{mask:02X}, /* {state} -> {', '.join(targets)} */ \\")
+    out.append("  }")
+    out.append("")
+    out.append("#endif\t/* FSM_TABLE_H */")
+    out.append("")
+    return "\n".join(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate the FSM tables of the PIC code from fsm.pu")
+    parser.add_argument("--check", action="store_true", help="Only check if the generated file is up to date")
+    args = parser.parse_args()
+
+    states, table, entries = parse_diagram(DIAGRAM.read_text())
+    header = generate(states, table, entries)
+
+    if args.check:
+        if not OUTPUT.exists() or OUTPUT.read_text() != header:
+            print(f"{OUTPUT.name} is out of date, run gen_fsm_table.py")
+            sys.exit(1)
+        print(f"{OUTPUT.name} is up to date")
+        return
+
+    OUTPUT.write_text(header)
+    print(f"Wrote {OUTPUT} ({len(states)} states, {len(table)} transitions)")
+
+
+if __name__ == "__main__":
+    main()
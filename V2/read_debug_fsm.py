@@ -1,3 +1,4 @@
+import math
 import serial
 import argparse
 from datetime import datetime
@@ -23,21 +24,57 @@ ERROR_FLAGS = {
     2: "SENSORS_UP_WHILE_NIGHT",
     4: "SENSORS_DOWN_WHILE_DAY",
     8: "MOTOR_RUN_TOO_LONG",
+    16: "ILLEGAL_TRANSITION",
 }
 
+# Timer0 sleep period: 65536 * 4us * 256
+SLEEP_PERIOD_S = 65536 * 4E-6 * 256
+
 class Config:
     dayThreshold = 200
     nightThreshold = 200
-    sleepCount = 5
+    sleepTime = 300
     dayCount = 3
     motorFullSpeed = 0
     motorHalfSpeed = 0
-    maxMotorCount = 0
-    motorDownFullCnt = 0
-    motorDownSlowCnt = 0
+    maxMotorTime = 0
+    motorDownFullTime = 0
+    motorDownSlowTime = 0
+
+# Input bits of a flight recorder (trace) record
+TRACE_INPUTS = {
+    1: "lSwitch",
+    2: "uButton",
+    4: "dButton",
+    8: "day",
+    16: "down",
+}
+
+# Timer1 count of the timing (P:) lines
+TIMING_US_PER_COUNT = 32
+TICK_BUDGET_US = 8192  # TMR0_WORK_PERIOD_US of TMR0_Driver.h
+
+# Steps of the boot profile (B:) lines, as in TIMING_Controller.h
+BOOT_STEPS = [
+    "Oscillator",
+    "Ports",
+    "Interrupts",
+    "TMR0",
+    "Motor",
+    "UART",
+    "ADC",
+    "Storage",
+    "FSM",
+    "Enable",
+    "First tick",
+]
 
 console = Console()
 config = Config()
+trace = []
+timing = {}
+boot = {}
+lost = {}
 
 def decode_errors(error_val: int):
     """Return list of active error names from bitfield"""
@@ -64,7 +101,8 @@ def parse_state(line, conf: Config):
     if dayCount > 0 and dayCount < conf.dayCount:
         dayText += "*"
 
-    sleepText = "." * conf.sleepCount
+    # The MCU wakes up every sleep period until the sleep time has passed
+    sleepText = "." * math.ceil(conf.sleepTime / SLEEP_PERIOD_S)
     for i in range(0, sleepCount):
         sleepText = sleepText[:i] + "*" + sleepText[i + 1:] 
 
@@ -92,17 +130,79 @@ def parse_config(line):
     
     conf.dayThreshold = int(parts[0])
     conf.nightThreshold = int(parts[1])
-    conf.sleepCount = int(parts[2])
+    conf.sleepTime = int(parts[2])
     conf.dayCount = int(parts[3])
     conf.motorFullSpeed = int(parts[4])
     conf.motorHalfSpeed = int(parts[5])
-    conf.maxMotorCount = int(parts[6])
-    conf.motorDownFullCnt = int(parts[7])
-    conf.motorDownSlowCnt = int(parts[8])
+    conf.maxMotorTime = int(parts[6])
+    conf.motorDownFullTime = int(parts[7])
+    conf.motorDownSlowTime = int(parts[8])
 
     return conf
     
 
+def parse_trace(line):
+    """Parse a 'T:state,next,speed,inputs,error' flight recorder line"""
+    parts = line.replace("T:", "").strip().split(",")
+    if len(parts) != 5:
+        print(f"ERROR: Invalid trace length: {len(parts)}")
+        return None
+
+    inputs = int(parts[3])
+    return [
+        STATE_MAP.get(int(parts[0]), f"Unknown({parts[0]})"),
+        STATE_MAP.get(int(parts[1]), f"Unknown({parts[1]})"),
+        parts[2],
+        " ".join(name for bit, name in TRACE_INPUTS.items() if inputs & bit),
+        ", ".join(decode_errors(int(parts[4]))),
+    ]
+
+
+def parse_timing(line):
+    """Parse a 'P:name,min,avg,max,jitter,extra' timing line, times in ms"""
+    parts = line.replace("P:", "").strip().split(",")
+    if len(parts) != 6:
+        print(f"ERROR: Invalid timing length: {len(parts)}")
+        return
+
+    to_ms = lambda v: f"{int(v) * TIMING_US_PER_COUNT / 1000:.2f}"
+    if parts[0] == "T":
+        name = "Tick"
+        extra = f"{parts[5]} overruns"
+    else:
+        name = STATE_MAP.get(int(parts[0]), f"Unknown({parts[0]})")
+        extra = f"{parts[5]} runs"
+    timing[name] = [name, to_ms(parts[1]), to_ms(parts[2]), to_ms(parts[3]), to_ms(parts[4]), extra]
+
+
+def parse_boot(line):
+    """Parse a 'B:step,time' boot profile line, time in ms since start up"""
+    parts = line.replace("B:", "").strip().split(",")
+    if len(parts) != 2:
+        print(f"ERROR: Invalid boot length: {len(parts)}")
+        return
+
+    step = int(parts[0])
+    name = BOOT_STEPS[step] if step < len(BOOT_STEPS) else f"Unknown({step})"
+    boot[step] = [name, f"{int(parts[1]) * TIMING_US_PER_COUNT / 1000:.2f}"]
+
+
+def parse_lost(line):
+    """Parse a 'Q:tick,button' line, events dropped because a queue was full"""
+    parts = line.replace("Q:", "").strip().split(",")
+    if len(parts) != 2:
+        print(f"ERROR: Invalid lost length: {len(parts)}")
+        return
+
+    lost["Tick events dropped"] = parts[0]
+    lost["Button events dropped"] = parts[1]
+
+
+def parse_missed(line):
+    """Parse a 'M:missed' line, task deadlines missed"""
+    lost["Task deadlines missed"] = line.replace("M:", "").strip()
+
+
 def parse_line(line):
     """Parse CSV line into structured dict"""
     try:
@@ -110,6 +210,19 @@ def parse_line(line):
         if line.startswith("C:"):
             global config 
             config = parse_config(line)
+        elif line.startswith("P:"):
+            parse_timing(line)
+        elif line.startswith("B:"):
+            parse_boot(line)
+        elif line.startswith("Q:"):
+            parse_lost(line)
+        elif line.startswith("M:"):
+            parse_missed(line)
+        elif line.startswith("T:"):
+            record = parse_trace(line)
+            if record:
+                trace.append(record)
+                del trace[:-32]
         else:
             return parse_state(line, config)
 
@@ -155,6 +268,29 @@ def main():
             console.print(table)
             if last_line:
                 console.print(Panel(last_line, title="Raw Line", style="dim"))
+            if timing:
+                timing_table = Table(title=f"Timing (budget {TICK_BUDGET_US / 1000}ms)", show_header=True, header_style="bold cyan")
+                for column in ["", "Min [ms]", "Avg [ms]", "Max [ms]", "Jitter [ms]", ""]:
+                    timing_table.add_column(column)
+                for row in timing.values():
+                    timing_table.add_row(*row)
+                console.print(timing_table)
+            if lost:
+                console.print("  ".join(f"{name}: {count}" for name, count in lost.items()))
+            if boot:
+                boot_table = Table(title="Boot profile", show_header=True, header_style="bold cyan")
+                for column in ["Step done", "At [ms]"]:
+                    boot_table.add_column(column)
+                for step in sorted(boot):
+                    boot_table.add_row(*boot[step])
+                console.print(boot_table)
+            if trace:
+                trace_table = Table(title="Last flight recorder trace", show_header=True, header_style="bold red")
+                for column in ["State", "Next", "Speed", "Inputs", "Error"]:
+                    trace_table.add_column(column)
+                for record in trace:
+                    trace_table.add_row(*record)
+                console.print(trace_table)
 
 if __name__ == "__main__":
     main()
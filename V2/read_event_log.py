@@ -0,0 +1,90 @@
+import serial
+import argparse
+
+# Event types as written by LOG_Controller.c
+EVENT_MAP = {
+    0: "Boot",
+    1: "DayNight",
+    2: "MotorRun",
+    3: "LimitSwitch",
+    4: "Error",
+}
+
+# Error bitfield mapping
+ERROR_FLAGS = {
+    1: "LIMIT_SWITCH_CLOSED",
+    2: "SENSORS_UP_WHILE_NIGHT",
+    4: "SENSORS_DOWN_WHILE_DAY",
+    8: "MOTOR_RUN_TOO_LONG",
+    16: "ILLEGAL_TRANSITION",
+}
+
+# Time stamps are counted in units of 64s of the uptime clock
+TIME_UNIT_S = 64
+
+# Motor running time is stored in units of 256ms
+MOTOR_UNIT_S = 0.256
+
+
+def decode_data(event, data):
+    if event == 0:
+        causes = []
+        if not data & 0x01:
+            causes.append("brown-out")
+        if not data & 0x02:
+            causes.append("power-on")
+        return "Reset: " + (", ".join(causes) if causes else "other")
+    if event == 1:
+        return "Day" if data else "Night"
+    if event == 2:
+        return f"{round(data * MOTOR_UNIT_S, 1)}s"
+    if event == 3:
+        return "Moving up" if data == 0 else "Moving down"
+    if event == 4:
+        errors = [name for bit, name in ERROR_FLAGS.items() if data & bit]
+        return ", ".join(errors) if errors else "Cleared"
+    return str(data)
+
+
+def parse_record(line):
+    """Parse a 'L:type,time,data' line, returns None when not a log record"""
+    if not line.startswith("L:"):
+        return None
+
+    parts = line.replace("L:", "").strip().split(",")
+    if len(parts) != 3:
+        print(f"ERROR: Invalid record length: {len(parts)}")
+        return None
+
+    event = int(parts[0])
+    time = int(parts[1])
+    data = int(parts[2])
+    return event, time, data
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Read the event log dumped by the controller. Hold both buttons while powering up to start the dump.")
+    parser.add_argument("--port", default="COM8", help="COM port to use (default: COM8)")
+    parser.add_argument("--baud", type=int, default=1200, help="Baud rate (default: 1200)")
+    args = parser.parse_args()
+
+    print(f"Listening on {args.port} at {args.baud} baud...\nPress Ctrl+C to exit.\n")
+
+    with serial.Serial(args.port, args.baud, timeout=1) as ser:
+        try:
+            while True:
+                line = ser.readline().decode(errors="ignore").strip()
+                record = parse_record(line)
+                if not record:
+                    continue
+
+                event, time, data = record
+                hours = round(time * TIME_UNIT_S / 3600, 1)
+                name = EVENT_MAP.get(event, f"Unknown({event})")
+                print(f"{time:>6} (+{hours:>7}h)  {name:<12} {decode_data(event, data)}")
+        except KeyboardInterrupt:
+            print("\nExiting...")
+
+
+if __name__ == "__main__":
+    main()
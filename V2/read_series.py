@@ -0,0 +1,109 @@
+import serial
+import argparse
+import csv
+
+# Must match SERIES_Controller.c
+KEY_SIZE = 4
+ESCAPE = 0x00
+
+
+class SeriesDecoder:
+    """Streaming decoder for one block of the light/battery series.
+    Feed it bytes one by one, every completed sample is returned."""
+
+    def __init__(self):
+        self.key = []
+        self.light = 0
+        self.battery = 0
+        self.escaped = False
+        self.deltas = []
+        self.varint = 0
+        self.shift = 0
+
+    def feed(self, byte):
+        """Feed one byte, returns (light, battery) when a sample is complete, else None"""
+        if len(self.key) < KEY_SIZE:
+            self.key.append(byte)
+            if len(self.key) == KEY_SIZE:
+                self.light = self.key[0] | (self.key[1] << 8)
+                self.battery = self.key[2] | (self.key[3] << 8)
+                return self.light, self.battery
+            return None
+
+        if not self.escaped:
+            if byte == ESCAPE:
+                self.escaped = True
+                return None
+            self.light += (byte >> 4) - 8
+            self.battery += (byte & 0x0F) - 8
+            return self.light, self.battery
+
+        # Zigzag varint deltas
+        self.varint |= (byte & 0x7F) << self.shift
+        self.shift += 7
+        if byte & 0x80:
+            return None
+
+        self.deltas.append((self.varint >> 1) ^ -(self.varint & 1))
+        self.varint = 0
+        self.shift = 0
+        if len(self.deltas) < 2:
+            return None
+
+        self.light = (self.light + self.deltas[0]) & 0xFFFF
+        self.battery = (self.battery + self.deltas[1]) & 0xFFFF
+        self.deltas = []
+        self.escaped = False
+        return self.light, self.battery
+
+
+def decode_block(line):
+    """Decode a 'S:<hex>' line, yields (light, battery) samples"""
+    decoder = SeriesDecoder()
+    data = bytes.fromhex(line.replace("S:", "").strip())
+    for byte in data:
+        sample = decoder.feed(byte)
+        if sample:
+            yield sample
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Read the light/battery series dumped by the controller. Push both buttons to start the dump.")
+    parser.add_argument("--port", default="COM8", help="COM port to use (default: COM8)")
+    parser.add_argument("--baud", type=int, default=1200, help="Baud rate (default: 1200)")
+    parser.add_argument("--csv", default=None, help="Also write the samples to this csv file")
+    args = parser.parse_args()
+
+    print(f"Listening on {args.port} at {args.baud} baud...\nPress Ctrl+C to exit.\n")
+
+    out = None
+    writer = None
+    if args.csv:
+        out = open(args.csv, "w", newline="")
+        writer = csv.writer(out)
+        writer.writerow(["block", "sample", "light", "battery"])
+
+    block = 0
+    with serial.Serial(args.port, args.baud, timeout=1) as ser:
+        try:
+            while True:
+                line = ser.readline().decode(errors="ignore").strip()
+                if not line.startswith("S:"):
+                    continue
+
+                count = 0
+                for light, battery in decode_block(line):
+                    print(f"{block:>3},{count:>4}: light={light:>4} battery={battery:>4}")
+                    if writer:
+                        writer.writerow([block, count, light, battery])
+                    count += 1
+                block += 1
+        except KeyboardInterrupt:
+            print("\nExiting...")
+        finally:
+            if out:
+                out.close()
+
+
+if __name__ == "__main__":
+    main()
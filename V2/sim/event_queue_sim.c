@@ -0,0 +1,156 @@
+/*
+ * Host simulation of the interrupt -> main() event path of the PIC code.
+ *
+ * Compares the event queue (Controllers/EVENT_Controller.c) with the single
+ * 'runFSM' flag it replaced, under bursts of button interrupts (contact
+ * bounce) on top of the 8,192ms TMR0 tick, and reports how many events are
+ * lost. Build and run on the host:
+ *
+ *   gcc -std=c99 -O2 -I../PIC/SafeChicks.X/Controllers -o event_queue_sim \
+ *       event_queue_sim.c ../PIC/SafeChicks.X/Controllers/EVENT_Controller.c
+ *   ./event_queue_sim
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "EVENT_Controller.h"
+#include "../Drivers/TMR0_Driver.h"
+
+#define SIM_TIME_US   (10UL * 60 * 1000 * 1000) /* 10 minutes              */
+#define TICK_US       TMR0_WORK_PERIOD_US       /* TMR0 work period        */
+#define SERVICE_US    2000UL                    /* Time main() needs/event */
+#define STALL_US      1000000UL                 /* check_force() delay     */
+
+typedef struct {
+  unsigned long produced;
+  unsigned long handled;
+  unsigned long lost;
+} Stats;
+
+/* Random number in [0, n) */
+static unsigned long rnd(unsigned long n) { return (unsigned long)rand() % n; }
+
+/**
+ * Run the simulation.
+ * @param pressesPerMin: button pushes per minute
+ * @param bounces: max interrupts per push (contact bounce)
+ * @param stallEvery: every this many ticks main() stalls for STALL_US, 0 never
+ * @param queue: stats for the event queue
+ * @param flag: stats for the single flag
+ */
+static void simulate(unsigned pressesPerMin, unsigned bounces,
+                     unsigned stallEvery, Stats *queue, Stats *flag) {
+  EventQueue ticks, buttons;
+  unsigned long t;
+  unsigned long nextTick = TICK_US;
+  unsigned long nextPress = 0;
+  unsigned long busyQueue = 0, busyFlag = 0; // main() busy until
+  unsigned long burstLeft = 0, nextBounce = 0;
+  unsigned long tickCount = 0;
+  int flagSet = 0;
+  Event e;
+
+  C_EVENT_Init(&ticks);
+  C_EVENT_Init(&buttons);
+  *queue = (Stats){0, 0, 0};
+  *flag = (Stats){0, 0, 0};
+
+  if (pressesPerMin > 0) {
+    nextPress = rnd(60000000UL / pressesPerMin);
+  }
+
+  for (t = 0; t < SIM_TIME_US; t += 100) {
+    Event produced = EVENT_NONE;
+
+    /* Interrupts */
+    if (t >= nextTick) {
+      nextTick += TICK_US;
+      tickCount++;
+      queue->produced++;
+      flag->produced++;
+      if (!C_EVENT_Push(&ticks, EVENT_TICK)) {
+        queue->lost++;
+      }
+      produced = EVENT_TICK;
+    } else if (pressesPerMin > 0 && t >= nextPress) {
+      nextPress = t + 1 + rnd(2 * 60000000UL / pressesPerMin);
+      burstLeft = 1 + rnd(bounces);
+      nextBounce = t;
+    }
+    if (burstLeft > 0 && t >= nextBounce) {
+      burstLeft--;
+      nextBounce = t + 200 + rnd(800);
+      queue->produced++;
+      flag->produced++;
+      if (!C_EVENT_Push(&buttons, EVENT_BUTTON_UP)) {
+        queue->lost++;
+      }
+      produced = EVENT_BUTTON_UP;
+    }
+    if (produced != EVENT_NONE) {
+      if (flagSet) {
+        flag->lost++; // Collapsed into the flag that is already set
+      }
+      flagSet = 1;
+    }
+
+    /* main() with the event queue */
+    if (t >= busyQueue) {
+      e = C_EVENT_Pop(&buttons);
+      if (e == EVENT_NONE) {
+        e = C_EVENT_Pop(&ticks);
+        while (e == EVENT_TICK && C_EVENT_Peek(&ticks) == EVENT_TICK) {
+          C_EVENT_Pop(&ticks); // Coalesced like main(), not lost
+        }
+      }
+      if (e != EVENT_NONE) {
+        queue->handled++;
+        busyQueue = t + (e == EVENT_TICK ? SERVICE_US : SERVICE_US / 4);
+        if (e == EVENT_TICK && stallEvery && tickCount % stallEvery == 0) {
+          busyQueue += STALL_US;
+        }
+      }
+    }
+
+    /* main() with the old runFSM flag */
+    if (t >= busyFlag && flagSet) {
+      flagSet = 0;
+      flag->handled++;
+      busyFlag = t + SERVICE_US;
+      if (stallEvery && tickCount % stallEvery == 0) {
+        busyFlag += STALL_US;
+      }
+    }
+  }
+}
+
+int main(void) {
+  static const struct {
+    unsigned pressesPerMin;
+    unsigned bounces;
+    unsigned stallEvery;
+  } scenarios[] = {
+      {0, 0, 0}, {6, 1, 0}, {6, 5, 0}, {60, 5, 0}, {60, 10, 0}, {60, 5, 500},
+  };
+  unsigned i;
+
+  srand(1);
+  printf("queue size %d, tick %luus, service %luus\n\n", EVENT_QUEUE_SIZE,
+         TICK_US, SERVICE_US);
+  printf("%8s %8s %8s | %10s %8s %8s | %8s %8s\n", "push/min", "bounces",
+         "stall", "events", "q lost", "q lost%", "flag lost", "flag%");
+
+  for (i = 0; i < sizeof(scenarios) / sizeof(scenarios[0]); i++) {
+    Stats queue, flag;
+    simulate(scenarios[i].pressesPerMin, scenarios[i].bounces,
+             scenarios[i].stallEvery, &queue, &flag);
+    printf("%8u %8u %8u | %10lu %8lu %7.2f%% | %8lu %7.2f%%\n",
+           scenarios[i].pressesPerMin, scenarios[i].bounces,
+           scenarios[i].stallEvery, queue.produced, queue.lost,
+           100.0 * queue.lost / queue.produced, flag.lost,
+           100.0 * flag.lost / flag.produced);
+  }
+
+  return 0;
+}
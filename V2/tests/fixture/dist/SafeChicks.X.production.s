@@ -0,0 +1,684 @@
+	processor	18F2550
+	pagewidth 120
+	opt	flic
+	psect	cinit,global,reloc=2,class=CODE,delta=1
+	psect	bssCOMRAM,global,class=COMRAM,space=1,delta=1,lowdata,noexec
+	psect	bssBANK0,global,class=BANK0,space=1,delta=1,lowdata,noexec
+	psect	cstackCOMRAM,global,class=COMRAM,space=1,delta=1,lowdata,noexec
+	psect	text0,global,reloc=2,class=CODE,delta=1
+	psect	intcode,global,reloc=2,class=CODE,delta=1
+	psect	intcodelo,global,reloc=2,class=CODE,delta=1
+
+	psect	bssCOMRAM
+global	_fsm
+_fsm:
+       ds      23
+global	_sleepHandler
+_sleepHandler:
+       ds      2
+	psect	bssBANK0
+global	_tickEvents
+_tickEvents:
+       ds      9
+global	_uartErrors
+_uartErrors:
+       ds      1
+	psect	cstackCOMRAM
+__pcstackCOMRAM:
+??_main:
+       ds      3
+
+	psect	text0
+	file	"main.c"
+	line	5
+global __ptext0
+__ptext0:
+;; *************** function _main *****************
+;; Defined at:
+;;		line 5 in file "main.c"
+;; Parameters:    Size  Location     Type
+;;		None
+;; Data sizes:     COMRAM   BANK0   BANK1   BANK2   BANK3   BANK4   BANK5   BANK6   BANK7
+;;      Params:         0       0       0       0       0       0       0       0       0
+;;      Locals:         0       0       0       0       0       0       0       0       0
+;;      Temps:          0       0       0       0       0       0       0       0       0
+;;      Totals:         0       0       0       0       0       0       0       0       0
+;;Total ram usage:        0 bytes
+;; Hardware stack levels required when called:    4
+;; This function calls:
+;;		_C_FSM_Tick
+;; This function is called by:
+;;		Startup code after reset
+;; This function uses a non-reentrant model
+;;
+psect	text0
+	file	"main.c"
+	line	5
+global __ptext0
+__ptext0:
+	opt callstack 0
+_main:
+	opt	callstack 27
+	line	7
+	
+l600:
+	call	_C_FSM_Tick	;wreg free
+	goto	l600
+	global	start
+	goto	start
+	opt callstack 0
+GLOBAL	__end_of_main
+	__end_of_main:
+	signat	_main,89
+
+	psect	text1,global,reloc=2,class=CODE,delta=1
+	file	"Controllers/FSM_Controller.c"
+	line	8
+global __ptext1
+__ptext1:
+;; *************** function _C_FSM_Tick *****************
+;; Defined at:
+;;		line 8 in file "Controllers/FSM_Controller.c"
+;; Parameters:    Size  Location     Type
+;;		None
+;; Data sizes:     COMRAM   BANK0   BANK1   BANK2   BANK3   BANK4   BANK5   BANK6   BANK7
+;;      Params:         0       0       0       0       0       0       0       0       0
+;;      Locals:         0       0       0       0       0       0       0       0       0
+;;      Temps:          0       0       0       0       0       0       0       0       0
+;;      Totals:         0       0       0       0       0       0       0       0       0
+;;Total ram usage:        0 bytes
+;; Hardware stack levels required when called:    3
+;; This function calls:
+;;		_state_execute
+;; This function is called by:
+;;		_main
+;; This function uses a non-reentrant model
+;;
+psect	text1
+	file	"Controllers/FSM_Controller.c"
+	line	8
+global __ptext1
+__ptext1:
+	opt callstack 0
+_C_FSM_Tick:
+	opt	callstack 27
+	line	9
+	
+l610:
+	movff	(_fsm+1),(_fsm)
+	line	10
+	movlw	low(_fsm)
+	movwf	((state_execute@fsm)),c
+	call	_state_execute	;wreg free
+	line	11
+	infsnz	((_fsm+2)),c
+	incf	((_fsm+3)),c
+	line	12
+	return	;funcret
+	opt callstack 0
+GLOBAL	__end_of_C_FSM_Tick
+	__end_of_C_FSM_Tick:
+	signat	_C_FSM_Tick,89
+
+	psect	text2,global,reloc=2,class=CODE,delta=1
+	file	"Controllers/FSM_Controller.c"
+	line	14
+global __ptext2
+__ptext2:
+;; *************** function _state_Sensor *****************
+;; Defined at:
+;;		line 14 in file "Controllers/FSM_Controller.c"
+;; Parameters:    Size  Location     Type
+;;  fsm             1    wreg     PTR struct .
+;; Auto vars:     Size  Location     Type
+;;  sum             2    1[COMRAM] unsigned short 
+;;  i               1    3[COMRAM] unsigned char 
+;; Data sizes:     COMRAM   BANK0   BANK1   BANK2   BANK3   BANK4   BANK5   BANK6   BANK7
+;;      Params:         0       0       0       0       0       0       0       0       0
+;;      Locals:         4       0       0       0       0       0       0       0       0
+;;      Temps:          0       0       0       0       0       0       0       0       0
+;;      Totals:         4       0       0       0       0       0       0       0       0
+;;Total ram usage:        4 bytes
+;; Hardware stack levels required when called:    1
+;; This function calls:
+;;		Nothing
+;; This function is called by:
+;;		_state_execute
+;; This function uses a non-reentrant model
+;;
+psect	text2
+	file	"Controllers/FSM_Controller.c"
+	line	14
+global __ptext2
+__ptext2:
+	opt callstack 0
+_state_Sensor:
+	opt	callstack 29
+	movwf	((state_Sensor@fsm)),c
+	line	15
+	
+l620:
+	clrf	((state_Sensor@sum)),c
+	clrf	((state_Sensor@sum+1)),c
+	line	17
+	clrf	((state_Sensor@i)),c
+	goto	l624
+	line	18
+	
+l622:
+	movf	((state_Sensor@fsm)),c,w
+	addlw	low(04h)
+	movwf	fsr2l,c
+	clrf	fsr2h,c
+	movf	postinc2,w,c
+	addwf	((state_Sensor@sum)),c
+	movf	postdec2,w,c
+	addwfc	((state_Sensor@sum+1)),c
+	line	17
+	incf	((state_Sensor@i)),c
+	
+l624:
+	movf	((state_Sensor@fsm)),c,w
+	addlw	low(06h)
+	movwf	fsr2l,c
+	movf	indf2,w,c
+	cpfslt	((state_Sensor@i)),c
+	goto	l626
+	goto	l622
+	line	20
+	
+l626:
+	movf	((state_Sensor@fsm)),c,w
+	addlw	low(07h)
+	movwf	fsr2l,c
+	movf	((state_Sensor@sum)),c,w
+	subwf	postinc2,w,c
+	movf	((state_Sensor@sum+1)),c,w
+	subwfb	postdec2,w,c
+	movlw	0
+	btfss	status,0,c
+	movlw	1
+	movwf	(??_state_Sensor),c
+	line	21
+	return	;funcret
+	opt callstack 0
+GLOBAL	__end_of_state_Sensor
+	__end_of_state_Sensor:
+	signat	_state_Sensor,4217
+
+	psect	text3,global,reloc=2,class=CODE,delta=1
+	file	"Controllers/FSM_Controller.c"
+	line	23
+global __ptext3
+__ptext3:
+;; *************** function _state_Error *****************
+;; Defined at:
+;;		line 23 in file "Controllers/FSM_Controller.c"
+;; Parameters:    Size  Location     Type
+;;  fsm             1    wreg     PTR struct .
+;; Data sizes:     COMRAM   BANK0   BANK1   BANK2   BANK3   BANK4   BANK5   BANK6   BANK7
+;;      Params:         0       0       0       0       0       0       0       0       0
+;;      Locals:         1       0       0       0       0       0       0       0       0
+;;      Temps:          0       0       0       0       0       0       0       0       0
+;;      Totals:         1       0       0       0       0       0       0       0       0
+;;Total ram usage:        1 bytes
+;; Hardware stack levels required when called:    3
+;; This function calls:
+;;		_D_UART_Write
+;; This function is called by:
+;;		_state_execute
+;; This function uses a non-reentrant model
+;;
+psect	text3
+	file	"Controllers/FSM_Controller.c"
+	line	23
+global __ptext3
+__ptext3:
+	opt callstack 0
+_state_Error:
+	opt	callstack 27
+	movwf	((state_Error@fsm)),c
+	line	24
+	
+l630:
+	movlw	low(STR_1)
+	movwf	((D_UART_Write@data)),c
+	movlw	high(STR_1)
+	movwf	((D_UART_Write@data+1)),c
+	call	_D_UART_Write	;wreg free
+	line	25
+	movf	((state_Error@fsm)),c,w
+	movwf	fsr2l,c
+	clrf	fsr2h,c
+	movlw	low(0)
+	movwf	indf2,c
+	line	26
+	return	;funcret
+	opt callstack 0
+GLOBAL	__end_of_state_Error
+	__end_of_state_Error:
+	signat	_state_Error,4217
+
+	psect	text4,global,reloc=2,class=CODE,delta=1
+	file	"Controllers/FSM_Controller.c"
+	line	28
+global __ptext4
+__ptext4:
+;; *************** function _state_Sleep *****************
+;; Defined at:
+;;		line 28 in file "Controllers/FSM_Controller.c"
+;; Parameters:    Size  Location     Type
+;;  fsm             1    wreg     PTR struct .
+;; Data sizes:     COMRAM   BANK0   BANK1   BANK2   BANK3   BANK4   BANK5   BANK6   BANK7
+;;      Params:         0       0       0       0       0       0       0       0       0
+;;      Locals:         1       0       0       0       0       0       0       0       0
+;;      Temps:          0       0       0       0       0       0       0       0       0
+;;      Totals:         1       0       0       0       0       0       0       0       0
+;;Total ram usage:        1 bytes
+;; Hardware stack levels required when called:    2
+;; This function calls:
+;;		Absolute function
+;; This function is called by:
+;;		_state_execute
+;; This function uses a non-reentrant model
+;;
+psect	text4
+	file	"Controllers/FSM_Controller.c"
+	line	28
+global __ptext4
+__ptext4:
+	opt callstack 0
+_state_Sleep:
+	opt	callstack 28
+	movwf	((state_Sleep@fsm)),c
+	line	29
+	
+l640:
+	rcall	u41
+	goto	u40
+u41:
+	push
+	movwf	tosl,c
+	movf	(_sleepHandler),c,w
+	movwf	tosl,c
+	movf	(_sleepHandler+1),c,w
+	movwf	tosh,c
+	clrf	tosu,c
+	return	;indir
+u40:
+	line	30
+	movf	((state_Sleep@fsm)),c,w
+	movwf	fsr2l,c
+	clrf	fsr2h,c
+	movlw	low(01h)
+	movwf	indf2,c
+	line	31
+	return	;funcret
+	opt callstack 0
+GLOBAL	__end_of_state_Sleep
+	__end_of_state_Sleep:
+	signat	_state_Sleep,4217
+
+	psect	text5,global,reloc=2,class=CODE,delta=1
+	file	"Controllers/FSM_Controller.c"
+	line	33
+global __ptext5
+__ptext5:
+;; *************** function _state_execute *****************
+;; Defined at:
+;;		line 33 in file "Controllers/FSM_Controller.c"
+;; Parameters:    Size  Location     Type
+;;  fsm             1    wreg     PTR struct .
+;; Data sizes:     COMRAM   BANK0   BANK1   BANK2   BANK3   BANK4   BANK5   BANK6   BANK7
+;;      Params:         0       0       0       0       0       0       0       0       0
+;;      Locals:         1       0       0       0       0       0       0       0       0
+;;      Temps:          2       0       0       0       0       0       0       0       0
+;;      Totals:         3       0       0       0       0       0       0       0       0
+;;Total ram usage:        3 bytes
+;; Hardware stack levels required when called:    2
+;; This function calls:
+;;		Absolute function
+;; This function is called by:
+;;		_C_FSM_Tick
+;; This function uses a non-reentrant model
+;;
+psect	text5
+	file	"Controllers/FSM_Controller.c"
+	line	33
+global __ptext5
+__ptext5:
+	opt callstack 0
+_state_execute:
+	opt	callstack 28
+	movwf	((state_execute@fsm)),c
+	line	34
+	
+l650:
+	movf	((state_execute@fsm)),c,w
+	movwf	fsr2l,c
+	clrf	fsr2h,c
+	rlncf	indf2,w,c
+	addlw	low(_stateHandlers)
+	movwf	tblptrl,c
+	clrf	tblptrh,c
+	tblrd	*+
+	movff	tablat,(??_state_execute)
+	tblrd	*+
+	movff	tablat,(??_state_execute+1)
+	movf	((state_execute@fsm)),c,w
+	rcall	u51
+	goto	u50
+u51:
+	push
+	movwf	tosl,c
+	movf	(??_state_execute),c,w
+	movwf	tosl,c
+	movf	(??_state_execute+1),c,w
+	movwf	tosh,c
+	clrf	tosu,c
+	return	;indir
+u50:
+	line	35
+	return	;funcret
+	opt callstack 0
+GLOBAL	__end_of_state_execute
+	__end_of_state_execute:
+	signat	_state_execute,4217
+
+	psect	text6,global,reloc=2,class=CODE,delta=1
+	file	"Drivers/UART_Driver.c"
+	line	5
+global __ptext6
+__ptext6:
+;; *************** function _D_UART_Write *****************
+;; Defined at:
+;;		line 5 in file "Drivers/UART_Driver.c"
+;; Parameters:    Size  Location     Type
+;;  data            2    0[COMRAM] PTR const unsigned char 
+;; Data sizes:     COMRAM   BANK0   BANK1   BANK2   BANK3   BANK4   BANK5   BANK6   BANK7
+;;      Params:         2       0       0       0       0       0       0       0       0
+;;      Locals:         0       0       0       0       0       0       0       0       0
+;;      Temps:          1       0       0       0       0       0       0       0       0
+;;      Totals:         3       0       0       0       0       0       0       0       0
+;;Total ram usage:        3 bytes
+;; Hardware stack levels required when called:    2
+;; This function calls:
+;;		_D_UART_WriteChar
+;; This function is called by:
+;;		_state_Error
+;; This function uses a non-reentrant model
+;;
+psect	text6
+	file	"Drivers/UART_Driver.c"
+	line	5
+global __ptext6
+__ptext6:
+	opt callstack 0
+_D_UART_Write:
+	opt	callstack 28
+	line	6
+	
+l660:
+	movff	(D_UART_Write@data),tblptrl
+	movff	(D_UART_Write@data+1),tblptrh
+	tblrd	*
+	movf	tablat,w,c
+	bz	l664
+	line	7
+	
+l662:
+	call	_D_UART_WriteChar	;wreg free
+	infsnz	((D_UART_Write@data)),c
+	incf	((D_UART_Write@data+1)),c
+	goto	l660
+	line	9
+	
+l664:
+	movlw	83
+u67:
+	decfsz	wreg,f,c
+	bra	u67
+	nop
+	line	10
+	return	;funcret
+	opt callstack 0
+GLOBAL	__end_of_D_UART_Write
+	__end_of_D_UART_Write:
+	signat	_D_UART_Write,4217
+
+	psect	text7,global,reloc=2,class=CODE,delta=1
+	file	"Drivers/UART_Driver.c"
+	line	12
+global __ptext7
+__ptext7:
+;; *************** function _D_UART_WriteChar *****************
+;; Defined at:
+;;		line 12 in file "Drivers/UART_Driver.c"
+;; Parameters:    Size  Location     Type
+;;  data            1    wreg     unsigned char 
+;; Auto vars:     Size  Location     Type
+;;  data            1    0[COMRAM] unsigned char 
+;;  max             1    1[COMRAM] unsigned char 
+;; Data sizes:     COMRAM   BANK0   BANK1   BANK2   BANK3   BANK4   BANK5   BANK6   BANK7
+;;      Params:         0       0       0       0       0       0       0       0       0
+;;      Locals:         2       0       0       0       0       0       0       0       0
+;;      Temps:          0       0       0       0       0       0       0       0       0
+;;      Totals:         2       0       0       0       0       0       0       0       0
+;;Total ram usage:        2 bytes
+;; Hardware stack levels required when called:    1
+;; This function calls:
+;;		Nothing
+;; This function is called by:
+;;		_D_UART_Write
+;; This function uses a non-reentrant model
+;;
+psect	text7
+	file	"Drivers/UART_Driver.c"
+	line	12
+global __ptext7
+__ptext7:
+	opt callstack 0
+_D_UART_WriteChar:
+	opt	callstack 29
+	movwf	((D_UART_WriteChar@data)),c
+	line	13
+	
+l670:
+	clrf	((D_UART_WriteChar@max)),c
+	line	15
+	goto	l674
+	line	16
+	
+l672:
+	incf	((D_UART_WriteChar@max)),c
+	line	17
+	nop
+	line	15
+	
+l674:
+	btfsc	((c:4012)),c,1	;volatile
+	goto	l676
+	movlw	low(0C8h)
+	cpfslt	((D_UART_WriteChar@max)),c
+	goto	l676
+	goto	l672
+	line	19
+	
+l676:
+	movff	(D_UART_WriteChar@data),(c:4013)	;volatile
+	line	20
+	return	;funcret
+	opt callstack 0
+GLOBAL	__end_of_D_UART_WriteChar
+	__end_of_D_UART_WriteChar:
+	signat	_D_UART_WriteChar,4217
+
+	psect	text8,global,reloc=2,class=CODE,delta=1
+	file	"main.c"
+	line	11
+global __ptext8
+__ptext8:
+;; *************** function _goToSleep *****************
+;; Defined at:
+;;		line 11 in file "main.c"
+;; Parameters:    Size  Location     Type
+;;		None
+;; Data sizes:     COMRAM   BANK0   BANK1   BANK2   BANK3   BANK4   BANK5   BANK6   BANK7
+;;      Params:         0       0       0       0       0       0       0       0       0
+;;      Locals:         0       0       0       0       0       0       0       0       0
+;;      Temps:          0       0       0       0       0       0       0       0       0
+;;      Totals:         0       0       0       0       0       0       0       0       0
+;;Total ram usage:        0 bytes
+;; Hardware stack levels required when called:    1
+;; This function calls:
+;;		Nothing
+;; This function is called by:
+;;		_state_Sleep
+;; This function uses a non-reentrant model
+;;
+psect	text8
+	file	"main.c"
+	line	11
+global __ptext8
+__ptext8:
+	opt callstack 0
+_goToSleep:
+	opt	callstack 28
+	line	12
+	
+l680:
+	sleep
+	line	13
+	nop
+	line	14
+	return	;funcret
+	opt callstack 0
+GLOBAL	__end_of_goToSleep
+	__end_of_goToSleep:
+	signat	_goToSleep,89
+
+	psect	intcode
+	file	"main.c"
+	line	16
+global __pintcode
+__pintcode:
+;; *************** function __HighInterruptManager *****************
+;; Defined at:
+;;		line 16 in file "main.c"
+;; Parameters:    Size  Location     Type
+;;		None
+;; Data sizes:     COMRAM   BANK0   BANK1   BANK2   BANK3   BANK4   BANK5   BANK6   BANK7
+;;      Params:         0       0       0       0       0       0       0       0       0
+;;      Locals:         0       0       0       0       0       0       0       0       0
+;;      Temps:          0       0       0       0       0       0       0       0       0
+;;      Totals:         0       0       0       0       0       0       0       0       0
+;;Total ram usage:        0 bytes
+;; Hardware stack levels required when called:    1
+;; This function calls:
+;;		Nothing
+;; This function is called by:
+;;		Interrupt level 2
+;; This function uses a non-reentrant model
+;;
+psect	intcode
+	file	"main.c"
+	line	16
+global __pintcode
+__pintcode:
+	opt callstack 0
+__HighInterruptManager:
+	opt	callstack 30
+	line	17
+	
+i2l700:
+	bcf	((c:4082)),c,1	;volatile
+	line	18
+	retfie	f
+	opt callstack 0
+GLOBAL	__end_of__HighInterruptManager
+	__end_of__HighInterruptManager:
+	signat	__HighInterruptManager,89
+
+	psect	intcodelo
+	file	"main.c"
+	line	20
+global __pintcodelo
+__pintcodelo:
+;; *************** function __LowInterruptManager *****************
+;; Defined at:
+;;		line 20 in file "main.c"
+;; Parameters:    Size  Location     Type
+;;		None
+;; Data sizes:     COMRAM   BANK0   BANK1   BANK2   BANK3   BANK4   BANK5   BANK6   BANK7
+;;      Params:         0       0       0       0       0       0       0       0       0
+;;      Locals:         0       0       0       0       0       0       0       0       0
+;;      Temps:          3       0       0       0       0       0       0       0       0
+;;      Totals:         3       0       0       0       0       0       0       0       0
+;;Total ram usage:        3 bytes
+;; Hardware stack levels required when called:    1
+;; This function calls:
+;;		Nothing
+;; This function is called by:
+;;		Interrupt level 1
+;; This function uses a non-reentrant model
+;;
+psect	intcodelo
+	file	"main.c"
+	line	20
+global __pintcodelo
+__pintcodelo:
+	opt callstack 0
+__LowInterruptManager:
+	opt	callstack 30
+	movff	wreg+0,??__LowInterruptManager+0
+	movff	status+0,??__LowInterruptManager+1
+	movff	bsr+0,??__LowInterruptManager+2
+	line	21
+	
+i1l710:
+	bcf	((c:4082)),c,2	;volatile
+	line	22
+	movlb	0	; () banked
+	incf	((_tickEvents+8))&0ffh,b
+	line	23
+	movff	??__LowInterruptManager+2,bsr+0
+	movff	??__LowInterruptManager+1,status+0
+	movff	??__LowInterruptManager+0,wreg+0
+	retfie
+	opt callstack 0
+GLOBAL	__end_of__LowInterruptManager
+	__end_of__LowInterruptManager:
+	signat	__LowInterruptManager,89
+
+	psect	smallconst
+STR_1:
+	db	low(045h)
+	db	low(0Ah)
+	db	low(0)
+
+;; Call Graph Tables:
+;;
+;; ---------------------------------------------------------------------------------
+;; (Depth) Function   	        Calls       Base Space   Used Autos Params    Refs
+;; ---------------------------------------------------------------------------------
+;; (0) _main                                                 0     0      0     120
+;;                         _C_FSM_Tick
+;; ---------------------------------------------------------------------------------
+;; (1) _C_FSM_Tick                                           0     0      0     110
+;;                      _state_execute
+;; ---------------------------------------------------------------------------------
+;; Estimated maximum stack depth 5
+;; ---------------------------------------------------------------------------------
+;; (Depth) Function   	        Calls       Base Space   Used Autos Params    Refs
+;; ---------------------------------------------------------------------------------
+;; (0) __LowInterruptManager                                 3     3      0       4
+;; ---------------------------------------------------------------------------------
+;; Estimated maximum stack depth 1
+;; ---------------------------------------------------------------------------------
+;; (Depth) Function   	        Calls       Base Space   Used Autos Params    Refs
+;; ---------------------------------------------------------------------------------
+;; (0) __HighInterruptManager                                 0     0      0       0
+;; ---------------------------------------------------------------------------------
+;; Estimated maximum stack depth 1
+;; ---------------------------------------------------------------------------------
+	end
@@ -0,0 +1,35 @@
+#include "FSM_Controller.h"
+
+Fsm fsm;
+SleepHandler sleepHandler;
+
+static void (*const stateHandlers[STATE_COUNT])(Fsm *) = FSM_HANDLER_TABLE;
+
+void C_FSM_Tick(void) {
+  fsm.state = fsm.next;
+  state_execute(&fsm);
+  fsm.epoch++;
+}
+
+void state_Sensor(Fsm *fsm) {
+  uint16_t sum = 0;
+
+  for (uint8_t i = 0; i < fsm->samples; i++) {
+    sum += fsm->light;
+  }
+  fsm->day = sum > fsm->threshold;
+}
+
+void state_Error(Fsm *fsm) {
+  D_UART_Write("E\n");
+  fsm->next = Sleep;
+}
+
+void state_Sleep(Fsm *fsm) {
+  sleepHandler();
+  fsm->next = Sensor;
+}
+
+void state_execute(Fsm *fsm) {
+  stateHandlers[fsm->state](fsm);
+}
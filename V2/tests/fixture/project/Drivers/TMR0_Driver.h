@@ -0,0 +1,8 @@
+#ifndef TMR0_DRIVER_H
+#define	TMR0_DRIVER_H
+
+#define TMR0_WORK_COUNTS    256     /* 8-bit, overflows after 256 counts  */
+#define TMR0_WORK_PRESCALE  8       /* 1:8 pre-scale                      */
+#define TMR0_WORK_PERIOD_US (TMR0_WORK_COUNTS * TMR0_WORK_PRESCALE * 4UL)
+
+#endif	/* TMR0_DRIVER_H */
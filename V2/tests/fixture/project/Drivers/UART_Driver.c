@@ -0,0 +1,20 @@
+#include "UART_Driver.h"
+
+uint8_t uartErrors = 0;
+
+void D_UART_Write(const char* data) {
+    while (*data != '\0') {
+        D_UART_WriteChar(*data++);
+    }
+    __delay_ms(1);
+}
+
+void D_UART_WriteChar(char data) {
+    uint8_t max = 0;
+    // Wait while buffer is still full
+    while(TXSTAbits.TRMT == 0 && max < 200) {
+        max++;
+        __delay_us(5);
+    }
+    TXREG = data;
+}
@@ -0,0 +1,6 @@
+#ifndef CONFIG_H
+#define CONFIG_H
+
+#define _XTAL_FREQ 1000000UL /* 1 MHz clock */
+
+#endif
@@ -0,0 +1,23 @@
+#include "config.h"
+
+EventQueue tickEvents;
+
+void main(void) {
+  while (1) {
+    C_FSM_Tick();
+  }
+}
+
+void goToSleep(void) {
+  SLEEP();
+  NOP();
+}
+
+void __interrupt(high_priority) _HighInterruptManager(void) {
+  INTCONbits.INT0IF = 0;
+}
+
+void __interrupt(low_priority) _LowInterruptManager(void) {
+  INTCONbits.TMR0IF = 0;
+  tickEvents.count++;
+}
@@ -0,0 +1,127 @@
+"""Checks footprint.py and wcet.py against the synthetic XC8 build in fixture/.
+
+fixture/dist is written by hand in the format of the map, memoryfile.xml and
+assembly of XC8 v2 for the PIC18F2550, for a few functions; it is not
+compiler output, see fixture/README.md. fixture/project holds the matching C
+lines, only what the tools read. The expected reports were checked by hand:
+module sizes are the psect lengths of the map and the "Totals" of every
+function plus the "ds" of the variables they define, the cycles follow from
+the PIC18 instruction table and LOOP_BOUNDS.
+
+Run from V2: python -m unittest discover tests
+"""
+
+import os
+import subprocess
+import sys
+import unittest
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+TOOLS = os.path.dirname(HERE)
+FIXTURE = os.path.join(HERE, "fixture")
+PROJECT = os.path.join(FIXTURE, "project")
+DIST = os.path.join(FIXTURE, "dist")
+
+sys.path.insert(0, TOOLS)
+import footprint  # noqa: E402
+import wcet  # noqa: E402
+import xc8_output  # noqa: E402
+
+
+def run(tool, *args):
+    """Exit code and output of one of the V2 tools on the fixture"""
+    done = subprocess.run([sys.executable, os.path.join(TOOLS, tool), "--project", PROJECT, "--dist", DIST, *args],
+                          capture_output=True, text=True)
+    return done.returncode, done.stdout
+
+
+def expected(name):
+    with open(os.path.join(FIXTURE, name)) as f:
+        return f.read()
+
+
+class XC8OutputTest(unittest.TestCase):
+    def test_psects(self):
+        psects = xc8_output.parse_map_psects(os.path.join(DIST, "SafeChicks.X.production.map"))
+        # Once per module, the TOTAL and SEGMENTS tables are not counted again
+        self.assertEqual(psects["text2"], (0x48, 0))
+        self.assertEqual(psects["bssCOMRAM"], (0x19, 1))
+        self.assertEqual(psects["cstackCOMRAM"], (0x0B, 1))
+
+    def test_asm(self):
+        functions, variables, depths = xc8_output.parse_asm(os.path.join(DIST, "SafeChicks.X.production.s"))
+        self.assertEqual(sorted(functions), [
+            "C_FSM_Tick", "D_UART_Write", "D_UART_WriteChar", "_HighInterruptManager",
+            "_LowInterruptManager", "goToSleep", "main", "state_Error", "state_Sensor",
+            "state_Sleep", "state_execute"])
+        sensor = functions["state_Sensor"]
+        self.assertEqual((sensor.file, sensor.line, sensor.psect, sensor.ram),
+                         (os.path.normpath("Controllers/FSM_Controller.c"), 14, "text2", 4))
+        # The compiled stack is not a variable
+        self.assertEqual(variables, {
+            "fsm": (23, "bssCOMRAM"), "sleepHandler": (2, "bssCOMRAM"),
+            "tickEvents": (9, "bssBANK0"), "uartErrors": (1, "bssBANK0")})
+        self.assertEqual(depths, {"main": 5, "_LowInterruptManager": 1, "_HighInterruptManager": 1})
+
+    def test_definitions(self):
+        owners = xc8_output.find_definitions(PROJECT, {"fsm", "sleepHandler", "tickEvents", "uartErrors"})
+        self.assertEqual(owners, {
+            "fsm": os.path.normpath("Controllers/FSM_Controller.c"),
+            "sleepHandler": os.path.normpath("Controllers/FSM_Controller.c"),
+            "tickEvents": "main.c",
+            "uartErrors": os.path.normpath("Drivers/UART_Driver.c")})
+
+
+class FootprintTest(unittest.TestCase):
+    def test_collect(self):
+        current = footprint.collect(PROJECT, DIST)
+        self.assertEqual(current["modules"][os.path.normpath("Controllers/FSM_Controller.c")], {"rom": 206, "ram": 34})
+        self.assertEqual(current["memory"], {"program": 373, "data": 46, "eeprom": 0})
+        self.assertEqual(current["cstack"], 11)
+
+    def test_report(self):
+        code, output = run("footprint.py", "--baseline", os.path.join(FIXTURE, "footprint-baseline.json"))
+        self.assertEqual(code, 0)
+        self.assertEqual(output, expected("footprint.txt"))
+
+    def test_max_growth(self):
+        baseline = os.path.join(FIXTURE, "footprint-baseline.json")
+        self.assertEqual(run("footprint.py", "--baseline", baseline, "--max-growth", "14")[0], 0)
+        self.assertEqual(run("footprint.py", "--baseline", baseline, "--max-growth", "13")[0], 1)
+
+
+class WcetTest(unittest.TestCase):
+    def setUp(self):
+        functions, _, _ = xc8_output.parse_asm(os.path.join(DIST, "SafeChicks.X.production.s"))
+        self.analyser = wcet.Analyser(functions, PROJECT, wcet.read_xtal(PROJECT))
+
+    def test_poll_loop(self):
+        # 4 in, 200 passes of 12 (the nop of __delay_us(5) is 1 cycle at 1MHz), 6 out
+        self.assertEqual(self.analyser.analyse("D_UART_WriteChar").cycles, 4 + 200 * 12 + 6)
+
+    def test_delay(self):
+        # 8 passes of the string loop, then __delay_ms(1): 250 cycles and its own loop once
+        result = self.analyser.analyse("D_UART_Write")
+        self.assertEqual(result.calls, {"D_UART_WriteChar": 8 * 2410})
+        self.assertEqual(result.cycles, 8 * 2426 + 256)
+
+    def test_assumed_bound(self):
+        result = self.analyser.analyse("state_Sensor")
+        self.assertTrue(result.assumed)
+        self.assertEqual(result.cycles, 6 + wcet.DEFAULT_LOOP_BOUND * 18 + 16)
+
+    def test_indirect_calls(self):
+        # stateHandlers[] takes the worst state, sleepHandler is goToSleep
+        self.assertEqual(self.analyser.analyse("state_execute").calls, {"state_Error": 19678})
+        sleep = self.analyser.analyse("state_Sleep")
+        self.assertEqual(sleep.calls, {"goToSleep": 4})
+        self.assertTrue(sleep.sleeps)
+
+    def test_report(self):
+        code, output = run("wcet.py")
+        self.assertEqual(code, 1)  # state_Error prints, it does not fit in a tick
+        self.assertEqual(output, expected("wcet.txt"))
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,442 @@
+"""Static worst-case execution time of SafeChicks.X, from the XC8 assembly.
+
+Every function of the generated assembly is turned into an instruction graph
+with PIC18 cycle counts. Loops get the bound from LOOP_BOUNDS, calls add the
+worst case of the callee and __delay_ms/us() adds the cycles asked for in the
+C source. The longest path from the entry is the worst case of the function.
+
+The FSM state handlers, both ISRs and C_FSM_Tick() are compared against the
+TMR0 work period: a tick has to be done before the next one is queued.
+
+A data EEPROM byte write takes ~4ms. D_EEPROM_Update() in C_FSM_Tick() only
+starts one, the waits show up where they block: D_EEPROM_Flush() before the
+SLEEP of state_Sleep, and D_EEPROM_Queue() when the queue is full.
+"""
+
+import argparse
+import fnmatch
+import os
+import re
+import sys
+
+import xc8_output
+
+DEFAULT_PROJECT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "PIC", "SafeChicks.X")
+
+# Loops in functions missing below get this bound, and are reported as assumed
+DEFAULT_LOOP_BOUND = 16
+
+# Max iterations of the loops of a function. Nested loops each get this bound,
+# so the number is the largest loop of the function (safe, not tight). Each
+# entry names the loop it bounds, check it when that loop changes.
+LOOP_BOUNDS = {
+    "D_UART_WriteChar": 200,    # UART_Driver.c: while (TRMT == 0 && max < 200)
+    "D_UART_Write": 8,          # UART_Driver.c: while (*data), "C:ERR\r\n" and the end test
+    "wait_write": 350,          # EEPROM_Driver.c: while (WR), 4ms write at 3 cycles a poll
+    "D_EEPROM_Queue": 2,        # EEPROM_Driver.c: while (next == eepromTail), one write makes room
+    "D_EEPROM_Update": 31,      # EEPROM_Driver.c: while (eepromTail != eepromHead), EEPROM_QUEUE_SIZE - 1
+    "D_EEPROM_Flush": 32,       # EEPROM_Driver.c: do .. while (WR), a pass per queued byte and the last
+    "D_EEPROM_Crc8": 16,        # EEPROM_Driver.c: while (size), CONFIG_BLOCK_SIZE - 1 = 14
+    "D_EEPROM_Crc8Add": 8,      # EEPROM_Driver.c: bit < 8
+    "D_ADC_ReadOnce": 4,        # ADC_Driver.c: while (!DONE), 11 TAD of 2us is 6 cycles
+    "C_PRINT_Str": 3,           # PRINT_Controller.c: while (*s), prefixes like "T:", and the end test
+    "C_PRINT_U16": 9,           # PRINT_Controller.c: POWERS_OF_TEN (4), up to 9 subtractions each
+    "C_CONFIG_Init": 16,        # CONFIG_Controller.c: i < sizeof(Config) (13)
+    "store": 16,                # CONFIG_Controller.c: i < sizeof(Config) (13)
+    "parse_values": 56,         # CONFIG_Controller.c: for (;; src++), CONFIG_LINE_SIZE
+    "C_CHECKPOINT_Load": 8,     # CHECKPOINT_Controller.c: i < sizeof(Checkpoint) (5)
+    "C_CHECKPOINT_Save": 8,
+    "add_micros": 68,           # CLOCK_Controller.c: a second a pass, after a 67.1s sleep period
+    "run_tasks": 4,             # FSM_Controller.c: i < TASK_COUNT
+    "C_LOG_Init": 56,           # LOG_Controller.c: erased slots up to LOG_SLOTS, then slot + 1 < LOG_SLOTS
+    "C_LOG_Dump": 56,           # LOG_Controller.c: i < LOG_SLOTS
+    "C_TRACE_Init": 32,         # TRACE_Controller.c: i < TRACE_SIZE
+    "C_TRACE_Dump": 32,         # TRACE_Controller.c: do .. while (i != traceHead)
+    "C_SERIES_Init": 12,        # SERIES_Controller.c: b < SERIES_BLOCKS
+    "C_SERIES_Dump": 64,        # SERIES_Controller.c: SERIES_BLOCKS (12), seriesUsed (64) bytes each
+    "put_varint": 2,            # SERIES_Controller.c: value >= 0x80, 16 bits is 2 passes
+    "C_TIMING_Init": 8,         # TIMING_Controller.c: i < STATE_COUNT
+    "C_TIMING_Report": 8,       # TIMING_Controller.c: i < STATE_COUNT
+    "C_TIMING_BootReport": 11,  # TIMING_Controller.c: i < BOOT_STEPS
+}
+
+# Possible targets of the function pointer calls, by calling function
+INDIRECT_CALLS = {
+    "state_execute": ["state_*"],   # stateHandlers[], see FSM_Table.h
+    "state_Sleep": ["goToSleep"],   # sleepHandler, set by C_FSM_Init()
+    "run_tasks": ["task_*"],        # tasks[].run
+}
+
+# Checked against the budget, next to all state_* handlers
+ISRS = ["_LowInterruptManager", "_HighInterruptManager"]
+TICK = "C_FSM_Tick"
+
+# PIC18 instruction set (non-extended)
+SKIPS = {"cpfseq", "cpfsgt", "cpfslt", "decfsz", "dcfsnz", "incfsz", "infsnz", "tstfsz", "btfsc", "btfss"}
+BRANCHES = {"bc", "bn", "bnc", "bnn", "bnov", "bnz", "bov", "bz"}
+JUMPS = {"bra", "goto", "ljmp", "jmp"}
+CALLS = {"call", "rcall", "fcall", "lcall"}
+RETURNS = {"return", "retlw", "retfie"}
+TWO_WORDS = {"movff", "lfsr", "goto", "ljmp", "jmp", "call", "fcall", "lcall"}
+TWO_CYCLES = {"movff", "lfsr", "tblrd", "tblwt"} | JUMPS | CALLS | RETURNS
+ONE_CYCLE = {
+    "addwf", "addwfc", "andwf", "clrf", "comf", "decf", "incf", "iorwf", "movf", "movwf",
+    "mulwf", "negf", "rlcf", "rlncf", "rrcf", "rrncf", "setf", "subfwb", "subwf", "subwfb",
+    "swapf", "xorwf", "bcf", "bsf", "btg", "addlw", "andlw", "iorlw", "movlb", "movlw",
+    "mullw", "sublw", "xorlw", "clrwdt", "daw", "nop", "pop", "push", "sleep",
+}
+# Registers that jump when written: computed goto or a call through a pointer
+PC_REGISTERS = {"pcl", "tosl", "tosh", "tosu"}
+
+LINE_DIRECTIVE = re.compile(r"^\s+line\s+(\d+)")
+INSTRUCTION = re.compile(r"^\s+([a-z]+)\*?[+-]?\*?(?:\s+([^;]*))?", re.IGNORECASE)
+LABEL = re.compile(r"^(\w+):")
+DELAY = re.compile(r"__delay_(ms|us)\s*\(\s*(\d+)\s*\)")
+
+
+class Instruction:
+    def __init__(self, mnemonic, operands, line):
+        self.mnemonic = mnemonic
+        self.operands = [o.strip().lower() for o in operands.split(",")] if operands else []
+        self.target = operands.split(",")[0].strip() if operands else ""
+        self.line = line  # C source line, from the line directives
+        self.words = 2 if mnemonic in TWO_WORDS else 1
+        self.cycles = 2 if mnemonic in TWO_CYCLES else 1
+
+    def writes_pc(self):
+        if self.mnemonic == "movwf":
+            return bool(self.operands) and self.operands[0] in PC_REGISTERS
+        if self.mnemonic == "movff":
+            return len(self.operands) > 1 and self.operands[1] in PC_REGISTERS
+        return self.mnemonic == "push"
+
+
+class Result:
+    def __init__(self):
+        self.cycles = 0
+        self.calls = {}        # Callee -> cycles it adds to the worst path
+        self.assumed = False   # DEFAULT_LOOP_BOUND used somewhere
+        self.unknown = []      # Calls and jumps that could not be followed
+        self.sleeps = False    # Executes SLEEP, counted as a single cycle
+
+
+class Analyser:
+    def __init__(self, functions, project, xtal):
+        self.functions = functions
+        self.project = project
+        self.cycles_per_us = xtal / 4 / 1e6
+        self.results = {}
+        self.busy = set()
+        self.sources = {}
+
+    def analyse(self, name):
+        """Worst case of a function and everything it calls"""
+        if name in self.results:
+            return self.results[name]
+        result = Result()
+        if name not in self.functions:
+            result.unknown.append(name)
+            return result
+        if name in self.busy:
+            result.unknown.append(f"recursion into {name}")
+            return result
+        self.busy.add(name)
+        result = self.analyse_function(self.functions[name])
+        self.busy.discard(name)
+        self.results[name] = result
+        return result
+
+    def delays(self, function):
+        """Cycles of the __delay_ms/us() calls, by C line of the function's file"""
+        path = os.path.join(self.project, function.file or "")
+        if path not in self.sources:
+            try:
+                with open(path, errors="ignore") as f:
+                    self.sources[path] = f.readlines()
+            except OSError:
+                self.sources[path] = []
+        cycles = {}
+        for number, text in enumerate(self.sources[path], start=1):
+            for unit, value in DELAY.findall(text):
+                us = int(value) * (1000 if unit == "ms" else 1)
+                cycles[number] = cycles.get(number, 0) + int(us * self.cycles_per_us)
+        return cycles
+
+    def indirect(self, name):
+        """Worst of the possible targets of a function pointer call in a function"""
+        targets = set()
+        for pattern in INDIRECT_CALLS.get(name, []):
+            targets |= {f for f in self.functions if fnmatch.fnmatch(f, pattern)}
+        targets.discard(name)
+        if not targets:
+            return None, None
+        worst = max(sorted(targets), key=lambda t: self.analyse(t).cycles)
+        return worst, self.analyse(worst)
+
+    def analyse_function(self, function):
+        result = Result()
+        code = []
+        labels = {}
+        line = 0
+        for text in function.body:
+            match = LINE_DIRECTIVE.match(text)
+            if match:
+                line = int(match.group(1))
+                continue
+            match = LABEL.match(text)
+            if match:
+                labels[match.group(1)] = len(code)
+                continue
+            match = INSTRUCTION.match(text)
+            if match:
+                mnemonic = match.group(1).lower()
+                if mnemonic in ONE_CYCLE or mnemonic in TWO_CYCLES or mnemonic in SKIPS or mnemonic in BRANCHES:
+                    code.append(Instruction(mnemonic, match.group(2), line))
+        if not code:
+            return result
+
+        delays = self.delays(function)
+        delays_counted = set()
+        # XC8 calls a pointer with a local rcall to a stub that writes the TOS,
+        # the callee is then counted at the rcall
+        local_calls = any(i.mnemonic in CALLS and i.target in labels for i in code)
+
+        cost = []
+        succ = []
+        calls = []
+        for i, ins in enumerate(code):
+            extra = 0
+            called = {}
+            nxt = [i + 1] if i + 1 < len(code) else []
+            m = ins.mnemonic
+
+            if ins.line in delays and ins.line not in delays_counted:
+                # Inline delay loop, counted from the C source
+                extra += delays[ins.line]
+                delays_counted.add(ins.line)
+            if m in SKIPS:
+                extra += code[i + 1].words if i + 1 < len(code) else 1
+                nxt = [j for j in (i + 1, i + 2) if j < len(code)]
+            elif m in BRANCHES:
+                extra += 1
+                if ins.target in labels:
+                    nxt.append(labels[ins.target])
+            elif m in JUMPS:
+                if ins.target in labels:
+                    nxt = [labels[ins.target]]
+                else:
+                    callee = xc8_output.c_name(ins.target)
+                    called[callee] = self.analyse(callee)  # Tail call
+                    nxt = []
+            elif m in CALLS:
+                if ins.target in labels:
+                    worst, sub = self.indirect(function.name)
+                    if worst:
+                        called[worst] = sub
+                    else:
+                        result.unknown.append(f"local call at line {ins.line}")
+                else:
+                    callee = xc8_output.c_name(ins.target)
+                    called[callee] = self.analyse(callee)
+            elif m in RETURNS:
+                nxt = []
+            elif m == "sleep":
+                result.sleeps = True
+            if ins.writes_pc() and not local_calls:
+                worst, sub = self.indirect(function.name)
+                if worst:
+                    called[worst] = sub
+                else:
+                    result.unknown.append(f"computed jump at line {ins.line}")
+            if ins.line in delays:
+                # The delay loop itself is already counted, drop its back edges
+                nxt = [j for j in nxt if j > i or code[j].line != ins.line]
+
+            for sub in called.values():
+                extra += sub.cycles
+                result.assumed |= sub.assumed
+                result.sleeps |= sub.sleeps
+                result.unknown += [u for u in sub.unknown if u not in result.unknown]
+            cost.append(ins.cycles + extra)
+            succ.append(nxt)
+            calls.append({callee: sub.cycles for callee, sub in called.items()})
+
+        bound = LOOP_BOUNDS.get(function.name, DEFAULT_LOOP_BOUND)
+        components = strongly_connected(list(range(len(code))), succ)
+        loops = [c for c in components if is_loop(c, succ)]
+        if loops and function.name not in LOOP_BOUNDS:
+            result.assumed = True
+
+        # Condensed graph, a loop is one node of bound times its code
+        owner = {}
+        weight = []
+        for index, component in enumerate(components):
+            for n in component:
+                owner[n] = index
+            weight.append(loop_cost(component, succ, cost, bound) if component in loops else cost[component[0]])
+
+        # Longest path from the entry, Tarjan gives reverse topological order
+        best = {owner[0]: weight[owner[0]]}
+        came = {owner[0]: None}
+        for index in reversed(range(len(components))):
+            if index not in best:
+                continue
+            for n in components[index]:
+                for s in succ[n]:
+                    target = owner[s]
+                    if target != index and best[index] + weight[target] > best.get(target, -1):
+                        best[target] = best[index] + weight[target]
+                        came[target] = index
+        index = max(best, key=best.get)
+        result.cycles = best[index]
+
+        while index is not None:
+            repeat = loop_repeat(components[index], succ, bound) if components[index] in loops else 1
+            for n in components[index]:
+                for callee, cycles in calls[n].items():
+                    result.calls[callee] = result.calls.get(callee, 0) + cycles * repeat
+            index = came[index]
+        return result
+
+
+def is_loop(component, succ):
+    return len(component) > 1 or component[0] in succ[component[0]]
+
+
+def strongly_connected(nodes, succ):
+    """Tarjan without recursion. Components as sorted node lists, in reverse
+    topological order."""
+    index = {}
+    low = {}
+    stack = []
+    on_stack = set()
+    components = []
+    for root in nodes:
+        if root in index:
+            continue
+        work = [(root, 0)]
+        while work:
+            node, i = work.pop()
+            if i == 0:
+                index[node] = low[node] = len(index)
+                stack.append(node)
+                on_stack.add(node)
+            for j in range(i, len(succ[node])):
+                nxt = succ[node][j]
+                if nxt not in index:
+                    work.append((node, j + 1))
+                    work.append((nxt, 0))
+                    break
+                if nxt in on_stack:
+                    low[node] = min(low[node], index[nxt])
+            else:
+                if low[node] == index[node]:
+                    component = []
+                    while True:
+                        n = stack.pop()
+                        on_stack.discard(n)
+                        component.append(n)
+                        if n == node:
+                            break
+                    components.append(sorted(component))
+                if work:
+                    parent = work[-1][0]
+                    low[parent] = min(low[parent], low[node])
+    return components
+
+
+def inner_graph(component, succ):
+    """Edges of a loop without the ones back to its header"""
+    header = component[0]
+    return {n: [s for s in succ[n] if s in component and s != header] for n in component}
+
+
+def loop_cost(component, succ, cost, bound):
+    """Bound times all code of the loop, inner loops multiplied again"""
+    inner = inner_graph(component, succ)
+    total = 0
+    for part in strongly_connected(component, inner):
+        total += loop_cost(part, inner, cost, bound) if is_loop(part, inner) else cost[part[0]]
+    return bound * total
+
+
+def loop_repeat(component, succ, bound):
+    """Times the deepest code of a loop is counted"""
+    inner = inner_graph(component, succ)
+    deepest = max((loop_repeat(part, inner, bound) for part in strongly_connected(component, inner)
+                   if is_loop(part, inner)), default=1)
+    return bound * deepest
+
+
+def read_tick_budget(project):
+    """TMR0 work period in instruction cycles, from TMR0_Driver.h"""
+    with open(os.path.join(project, "Drivers", "TMR0_Driver.h"), errors="ignore") as f:
+        text = f.read()
+    counts = re.search(r"#define\s+TMR0_WORK_COUNTS\s+(\d+)", text)
+    prescale = re.search(r"#define\s+TMR0_WORK_PRESCALE\s+(\d+)", text)
+    if not counts or not prescale:
+        sys.exit("No TMR0_WORK_COUNTS or TMR0_WORK_PRESCALE in Drivers/TMR0_Driver.h")
+    return int(counts.group(1)) * int(prescale.group(1))
+
+
+def read_xtal(project):
+    with open(os.path.join(project, "config.h"), errors="ignore") as f:
+        match = re.search(r"#define\s+_XTAL_FREQ\s+(\d+)", f.read())
+    return int(match.group(1)) if match else 1000000
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Worst-case execution time of the FSM states, ISRs and tick of the last XC8 build.")
+    parser.add_argument("--project", default=DEFAULT_PROJECT, help="MPLAB X project directory (default: SafeChicks.X)")
+    parser.add_argument("--dist", help="Build output directory (default: <project>/dist/default/production)")
+    parser.add_argument("--verbose", action="store_true", help="Show the calls on the worst path of every checked function")
+    args = parser.parse_args()
+
+    dist = args.dist or os.path.join(args.project, "dist", "default", "production")
+    asm = xc8_output.find_outputs(dist)["asm"]
+    if not asm:
+        sys.exit(f"No assembly output in {dist}, build the project first")
+
+    functions, _, _ = xc8_output.parse_asm(asm)
+    xtal = read_xtal(args.project)
+    budget = read_tick_budget(args.project)
+    analyser = Analyser(functions, args.project, xtal)
+
+    def ms(cycles):
+        return cycles / analyser.cycles_per_us / 1000
+
+    checked = sorted(f for f in functions if f.startswith("state_") and f != "state_execute")
+    checked += [f for f in ISRS + [TICK] if f in functions]
+    over_budget = False
+
+    print(f"Budget: TMR0 work period of {budget} cycles, {ms(budget):.2f}ms at {xtal / 1e6:g}MHz\n")
+    print(f"{'Function':<24} {'Cycles':>9} {'ms':>8} {'Budget':>7}  Notes")
+    for name in checked:
+        result = analyser.analyse(name)
+        over = result.cycles > budget
+        over_budget |= over
+        notes = ["OVER BUDGET"] if over else []
+        if result.sleeps:
+            notes.append("sleeps, time asleep not counted")
+        if result.assumed:
+            notes.append(f"loop bound of {DEFAULT_LOOP_BOUND} assumed")
+        if result.unknown:
+            notes.append("not followed: " + ", ".join(result.unknown))
+        print(f"{name:<24} {result.cycles:>9} {ms(result.cycles):>8.2f} "
+              f"{100 * result.cycles / budget:>6.0f}%  {'; '.join(notes)}")
+        if over or args.verbose:
+            for callee, cycles in sorted(result.calls.items(), key=lambda c: -c[1]):
+                print(f"    {callee:<28} {cycles:>9}")
+
+    # Each ISR may run once while the tick is busy
+    if TICK in functions:
+        total = analyser.analyse(TICK).cycles + sum(analyser.analyse(f).cycles for f in ISRS if f in functions)
+        over = total > budget
+        over_budget |= over
+        print(f"\n{TICK} interrupted by both ISRs: {total} cycles, {ms(total):.2f}ms{'  OVER BUDGET' if over else ''}")
+
+    sys.exit(1 if over_budget else 0)
+
+
+if __name__ == "__main__":
+    main()
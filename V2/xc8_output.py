@@ -0,0 +1,167 @@
+"""Readers for the files an XC8 (v2, PIC18) build of SafeChicks.X leaves behind.
+
+The MPLAB makefile links with -Wl,-Map=...map, -Wl,--memorysummary,memoryfile.xml
+and -fasmfile, so dist/<conf>/<type>/ holds a map file, memoryfile.xml and the
+generated assembly (.s). The assembly comments tell which C file and line every
+function comes from, its compiled stack use, and the call graph.
+"""
+
+import glob
+import os
+import re
+import xml.etree.ElementTree as ET
+
+# PIC18F2550 limits
+HARDWARE_STACK_LEVELS = 31
+
+
+def find_outputs(dist):
+    """Find the map, memory summary and assembly file in a dist directory"""
+    def first(pattern):
+        found = sorted(glob.glob(os.path.join(dist, pattern)))
+        return found[0] if found else None
+
+    return {
+        "map": first("*.map"),
+        "memory": first("memoryfile.xml"),
+        "asm": first("*.s") or first("*.as") or first("*.lst"),
+    }
+
+
+def parse_memoryfile(path):
+    """Used and total size per memory (program, data, eeprom) in bytes"""
+    memories = {}
+    for memory in ET.parse(path).getroot().iter("memory"):
+        name = memory.get("name")
+        used = memory.findtext("used")
+        length = memory.findtext("length")
+        if name and used is not None:
+            memories[name] = (int(used, 0), int(length, 0) if length else 0)
+    return memories
+
+
+# "  text12   1A2E   1A2E   44   D   0   1" (Name Link Load Length Selector Space Scale)
+PSECT_LINE = re.compile(r"^\s+(\w+)\s+([0-9A-F]+)\s+([0-9A-F]+)\s+([0-9A-F]+)\s+([0-9A-F]+)\s+(\d+)(?:\s+\d+)?\s*$")
+
+
+def parse_map_psects(path):
+    """Length and space of every psect in the map (space 0 is ROM, 1 is RAM)"""
+    psects = {}
+    with open(path, errors="ignore") as f:
+        for line in f:
+            match = PSECT_LINE.match(line)
+            if not match:
+                continue
+            name, _, _, length, _, space = match.groups()
+            total, _ = psects.get(name, (0, 0))
+            psects[name] = (total + int(length, 16), int(space))
+    return psects
+
+
+class Function:
+    """One function of the generated assembly"""
+
+    def __init__(self, name):
+        self.name = name          # C name, without the leading underscore
+        self.file = None          # C file it is defined in
+        self.line = 0
+        self.psect = None         # Code psect holding the function
+        self.ram = 0              # Compiled stack bytes (params, locals, temps)
+        self.body = []            # Assembly lines from the label to the next function
+
+
+FUNCTION_HEADER = re.compile(r"^;; \*+ function (\w+) \*+")
+DEFINED_AT = re.compile(r'^;;\s+line (\d+) in file "([^"]+)"')
+TOTALS = re.compile(r"^;;\s+Totals:\s+([\d\s]+)$")
+PSECT = re.compile(r"^\s*psect\s+(\w+)")
+LABEL = re.compile(r"^(\w+):")
+DS = re.compile(r"^\s+ds\s+(\d+)")
+STACK_ROOT = re.compile(r"^;; \(0\) (\w+)")
+STACK_DEPTH = re.compile(r"^;; Estimated maximum stack depth (\d+)")
+
+
+def c_name(symbol):
+    return symbol[1:] if symbol.startswith("_") else symbol
+
+
+def parse_asm(path):
+    """Functions, RAM variables and call graph stack depths of the assembly.
+
+    Returns (functions, variables, depths): functions by C name, variables as
+    {C name: (bytes, psect)} and depths as {root function: hardware levels}.
+    """
+    functions = {}
+    variables = {}
+    depths = {}
+    current = None
+    psect = None
+    root = None
+    label = None
+
+    with open(path, errors="ignore") as f:
+        for line in f:
+            line = line.rstrip("\n")
+
+            match = PSECT.match(line)
+            if match:
+                psect = match.group(1)
+                if current and psect != current.psect:
+                    current = None  # Every function has its own psect
+                continue
+
+            match = FUNCTION_HEADER.match(line)
+            if match:
+                current = Function(c_name(match.group(1)))
+                current.psect = psect
+                functions[current.name] = current
+                continue
+
+            match = STACK_ROOT.match(line)
+            if match:
+                root = c_name(match.group(1))
+            match = STACK_DEPTH.match(line)
+            if match and root:
+                depths[root] = int(match.group(1))
+                continue
+
+            if current and line.startswith(";;"):
+                match = DEFINED_AT.match(line)
+                if match and current.file is None:
+                    current.line = int(match.group(1))
+                    current.file = os.path.normpath(match.group(2))
+                match = TOTALS.match(line)
+                if match:
+                    current.ram = sum(int(v) for v in match.group(1).split())
+                continue
+
+            match = LABEL.match(line)
+            if match:
+                label = match.group(1)
+            match = DS.match(line)
+            if match and label and psect and not psect.startswith("cstack"):
+                # Global or static variable, cstack is the compiled stack
+                variables[c_name(label)] = (int(match.group(1)), psect)
+                label = None
+                continue
+
+            if current:
+                current.body.append(line)
+
+    return functions, variables, depths
+
+
+def find_definitions(source_dir, names):
+    """Map variable names to the C file that defines them at file scope"""
+    found = {}
+    for path in glob.glob(os.path.join(source_dir, "**", "*.c"), recursive=True):
+        if "nbproject" in path:
+            continue
+        rel = os.path.normpath(os.path.relpath(path, source_dir))
+        with open(path, errors="ignore") as f:
+            for line in f:
+                if not line[:1].isalpha() or line.startswith(("extern", "typedef", "return")):
+                    continue
+                for name in re.findall(r"\b(\w+)\s*(?:\[[^\]]*\])*\s*(?:=|;|,)", line):
+                    if name in names and name not in found:
+                        found[name] = rel
+    return found